@@ -0,0 +1,92 @@
+/* hash_bytes throughput at several lengths against the FNV-1a loop the
+    interner used before, Hasher fed the same input in chunks, and the integer
+    mixers in ns per call. */
+#include "preamble.h"
+#include <stdlib.h>
+#include <time.h>
+
+#define BUFFER_SIZE KILOBYTES(64)
+#define TOTAL_BYTES MEGABYTES(512)
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static u64 fnv1a(const u8* data, usize size)
+{
+    u64 hash = 0xCBF29CE484222325ULL;
+    for (usize i = 0; i < size; ++i)
+        hash = (hash ^ data[i]) * 0x100000001B3ULL;
+    return hash;
+}
+
+int main(void)
+{
+    /* 16 spare bytes so short keys can start at different offsets. */
+    u8* bytes = (u8*) malloc(BUFFER_SIZE + 16);
+    for (usize i = 0; i < BUFFER_SIZE + 16; ++i)
+        bytes[i] = (u8) (i * 7 + 3);
+
+    usize sizes[] = { 8, 32, 256, KILOBYTES(1), KILOBYTES(64) };
+    u64   check   = 0;
+    for (usize s = 0; s < ARRAY_COUNT(sizes); ++s)
+    {
+        usize size  = sizes[s];
+        usize calls = TOTAL_BYTES / size;
+
+        /* The seed and offset change every call, so nothing is hoisted. */
+        double start = seconds();
+        for (usize i = 0; i < calls; ++i)
+            check += hash_bytes(bytes + (i & 15), size, i);
+        double ours = seconds() - start;
+
+        usize fnv_calls = calls / 8;
+        start = seconds();
+        for (usize i = 0; i < fnv_calls; ++i)
+            check += fnv1a(bytes + (i & 15), size);
+        double theirs = (seconds() - start) * 8;
+
+        double gigabytes = (double) size * calls * 1e-9;
+        printf("hash_bytes %6zu B  %6.2f GB/s %8.1f ns   fnv1a %5.2f GB/s %9.1f ns\n", size,
+               gigabytes / ours, ours / calls * 1e9, gigabytes / theirs, theirs / calls * 1e9);
+    }
+
+    usize chunks[] = { 16, 100, 4096 };
+    for (usize c = 0; c < ARRAY_COUNT(chunks); ++c)
+    {
+        usize  rounds = TOTAL_BYTES / BUFFER_SIZE;
+        double start  = seconds();
+        for (usize round = 0; round < rounds; ++round)
+        {
+            Hasher hasher = hasher_make(round);
+            for (usize offset = 0; offset < BUFFER_SIZE; offset += chunks[c])
+                hasher_update(&hasher, bytes + offset, chunks[c] < BUFFER_SIZE - offset ? chunks[c] : BUFFER_SIZE - offset);
+            check += hasher_finish(&hasher);
+        }
+        double elapsed = seconds() - start;
+        printf("Hasher, %4zu B chunks  %6.2f GB/s\n", chunks[c], (double) TOTAL_BYTES * 1e-9 / elapsed);
+    }
+
+    /* Each call feeds the next, so these are latencies, as when a table
+        lookup waits on the hash. */
+    usize calls = 100000000;
+    u64   x     = 1;
+    double start = seconds();
+    for (usize i = 0; i < calls; ++i)
+        x = hash_u64(x + i);
+    double mix_64 = seconds() - start;
+
+    u32 y = 1;
+    start = seconds();
+    for (usize i = 0; i < calls; ++i)
+        y = hash_u32(y + (u32) i);
+    double mix_32 = seconds() - start;
+
+    printf("hash_u64 %5.2f ns   hash_u32 %5.2f ns   (%llu)\n", mix_64 / calls * 1e9, mix_32 / calls * 1e9,
+           (unsigned long long) ((check ^ x ^ y) & 1));
+    free(bytes);
+    return 0;
+}
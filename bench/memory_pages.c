@@ -0,0 +1,61 @@
+/* Arenas on normal, transparent huge and explicit huge pages: the cost of
+    faulting in 1 GiB on first touch, then random 8-byte reads over it, which
+    are bound by TLB misses. */
+#include "preamble.h"
+#include <time.h>
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static const char* page_name(MemoryPages pages)
+{
+    return pages == MEMORY_PAGES_NORMAL ? "normal" : pages == MEMORY_PAGES_HUGE_TRANSPARENT ? "transparent huge" : "explicit huge";
+}
+
+int main(void)
+{
+    usize       size    = GIGABYTES(1);
+    usize       count   = size / sizeof(u64);
+    usize       reads   = 20000000;
+    MemoryPages kinds[] = { MEMORY_PAGES_NORMAL, MEMORY_PAGES_HUGE_TRANSPARENT, MEMORY_PAGES_HUGE_EXPLICIT };
+    for (usize k = 0; k < ARRAY_COUNT(kinds); ++k)
+    {
+        Arena arena = arena_make(size, kinds[k]);
+        if (!arena.base || arena.pages != kinds[k])
+        {
+            printf("%-16s  unavailable\n", page_name(kinds[k]));
+            arena_free(&arena);
+            continue;
+        }
+
+        double start = seconds();
+        u64*   words = ARENA_PUSH_ARRAY(&arena, u64, count);
+        for (usize i = 0; i < count; i += 512)
+            words[i] = i;
+        double touch = seconds() - start;
+        for (usize i = 0; i < count; ++i)
+            words[i] = i;
+
+        u64 state = 1;
+        u64 sum   = 0;
+        start = seconds();
+        for (usize i = 0; i < reads; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            sum   += words[state & (count - 1)];
+        }
+        double read = seconds() - start;
+
+        printf("%-16s  first touch %6.1f ms (%5.0f ns per 4 KiB)  random reads %5.1f M/s  (%llu)\n",
+               page_name(kinds[k]), touch * 1e3, touch * 1e9 / (double) (size / 4096),
+               (double) reads / read * 1e-6, (unsigned long long) sum);
+        arena_free(&arena);
+    }
+    return 0;
+}
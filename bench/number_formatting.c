@@ -0,0 +1,56 @@
+/* Nanoseconds per call for the number formatters against snprintf, on random
+    values of mixed magnitude. */
+#include "preamble.h"
+#include <time.h>
+
+#define VALUE_COUNT 1024
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static u64 random_state = 88172645463325252ULL;
+
+static u64 random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+int main(void)
+{
+    static u64 values[VALUE_COUNT];
+    for (usize i = 0; i < VALUE_COUNT; ++i)
+        values[i] = random_next() >> (random_next() % 64);
+
+    utf8   buffer[64];
+    usize  check = 0;
+    double calls = 5000.0 * VALUE_COUNT;
+
+    double start = seconds();
+    for (int round = 0; round < 5000; ++round)
+        for (usize i = 0; i < VALUE_COUNT; ++i)
+            check += format_u64(buffer, values[i]);
+    double ours = seconds() - start;
+
+    start = seconds();
+    for (int round = 0; round < 500; ++round)
+        for (usize i = 0; i < VALUE_COUNT; ++i)
+            check += (usize) snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long) values[i]);
+    double theirs = (seconds() - start) * 10;
+
+    start = seconds();
+    for (int round = 0; round < 5000; ++round)
+        for (usize i = 0; i < VALUE_COUNT; ++i)
+            check += format_u64_hex(buffer, values[i]);
+    double hex = seconds() - start;
+
+    printf("format_u64      %6.1f ns   snprintf %%llu  %6.1f ns\n", ours / calls * 1e9, theirs / calls * 1e9);
+    printf("format_u64_hex  %6.1f ns   (%zu)\n", hex / calls * 1e9, check);
+    return 0;
+}
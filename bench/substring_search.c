@@ -0,0 +1,75 @@
+/* string_find and string_rfind throughput in haystack GB/s against memmem and
+    strstr, on 64 MiB of random text with needles that never match, and on a
+    run of one byte with needles built to defeat the first-and-last-byte
+    filter. */
+#define _GNU_SOURCE  /* memmem */
+#include "preamble.h"
+#include <stdlib.h>
+#include <time.h>
+
+#define ROUNDS 10
+
+/* Read afresh each round, so the compiler can't hoist the libc calls, which
+    it knows to be pure, out of the loops. */
+static const char* volatile current_text;
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static void run(const char* name, const char* text, usize size, const char* pattern)
+{
+    current_text = text;
+    String needle = string_from_cstring(pattern);
+    usize  check  = 0;
+
+    double start = seconds();
+    for (int round = 0; round < ROUNDS; ++round)
+        check += string_find(string_make(current_text, size), needle);
+    double find = seconds() - start;
+
+    start = seconds();
+    for (int round = 0; round < ROUNDS; ++round)
+        check += string_rfind(string_make(current_text, size), needle);
+    double rfind = seconds() - start;
+
+    start = seconds();
+    for (int round = 0; round < ROUNDS; ++round)
+        check += (usize) memmem(current_text, size, needle.data, needle.size);
+    double libc_memmem = seconds() - start;
+
+    start = seconds();
+    for (int round = 0; round < ROUNDS; ++round)
+        check += (usize) strstr(current_text, pattern);
+    double libc_strstr = seconds() - start;
+
+    double bytes = (double) size * ROUNDS * 1e-9;
+    printf("%-24s  find %6.2f GB/s  rfind %6.2f  memmem %6.2f  strstr %6.2f  (%zu)\n",
+           name, bytes / find, bytes / rfind, bytes / libc_memmem, bytes / libc_strstr, check & 1);
+}
+
+int main(void)
+{
+    usize size  = MEGABYTES(64);
+    char* text  = (char*) malloc(size + 1);
+    u64   state = 1;
+    for (usize i = 0; i < size; ++i)
+    {
+        state   = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        text[i] = " etaoinshrdlucmfwyp"[(state >> 33) % 19];
+    }
+    text[size] = 0;
+    run("text, 5 byte needle", text, size, "zqxjk");
+    run("text, 16 byte needle", text, size, "the quick brownz");
+    run("text, 64 byte needle", text, size, "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789!@");
+
+    memset(text, 'a', size);
+    run("aaaa, a^15 b a", text, size, "aaaaaaaaaaaaaaaba");
+    run("aaaa, a^63 b", text, size, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab");
+    run("aaaa, b a^63", text, size, "baaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    free(text);
+    return 0;
+}
@@ -0,0 +1,103 @@
+/* Transcoding throughput in input GB/s over 32 MiB of ASCII, Latin text with
+    a third of CJK, pure CJK and emoji, against a scalar utf8_decode loop. */
+#include "preamble.h"
+#include <stdlib.h>
+#include <time.h>
+
+#define ROUNDS 5
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+static u64 random_state = 1;
+
+static u64 random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+static rune random_rune(int kind)
+{
+    switch (kind)
+    {
+        case 0:  return 'a' + (rune) (random_next() % 26);
+        case 1:  return random_next() % 3 ? 'a' + (rune) (random_next() % 26) : 0x4E00 + (rune) (random_next() % 0x5000);
+        case 2:  return 0x4E00 + (rune) (random_next() % 0x5000);
+        default: return 0x1F600 + (rune) (random_next() % 0x50);
+    }
+}
+
+static usize scalar_decode(const utf8* input, usize size, rune* output)
+{
+    usize read    = 0;
+    usize written = 0;
+    while (read < size)
+    {
+        usize length = utf8_decode(input + read, size - read, output + written);
+        if (!length)
+            break;
+        read += length;
+        written += 1;
+    }
+    return written;
+}
+
+int main(void)
+{
+    const char* names[] = { "ascii", "mixed", "cjk", "emoji" };
+    usize size  = MEGABYTES(32);
+    utf8* text  = (utf8*) malloc(size + 4);
+    rune* runes = (rune*) malloc(size * sizeof(rune));
+    u16*  units = (u16*)  malloc(size * sizeof(u16));
+    utf8* back  = (utf8*) malloc(size * 4);
+    for (int kind = 0; kind < 4; ++kind)
+    {
+        usize filled = 0;
+        while (filled + 4 <= size)
+            filled += utf8_encode(random_rune(kind), text + filled);
+
+        usize  check = 0;
+        double start = seconds();
+        for (int round = 0; round < ROUNDS; ++round)
+            check += scalar_decode(text, filled, runes);
+        double scalar = seconds() - start;
+
+        start = seconds();
+        for (int round = 0; round < ROUNDS; ++round)
+            check += utf8_to_utf32(text, filled, runes).written;
+        double to_32 = seconds() - start;
+        usize  count = utf8_to_utf32(text, filled, runes).written;
+
+        start = seconds();
+        for (int round = 0; round < ROUNDS; ++round)
+            check += utf32_to_utf8(runes, count, back).written;
+        double from_32 = seconds() - start;
+
+        start = seconds();
+        for (int round = 0; round < ROUNDS; ++round)
+            check += utf8_to_utf16(text, filled, units).written;
+        double to_16 = seconds() - start;
+        usize  unit_count = utf8_to_utf16(text, filled, units).written;
+
+        start = seconds();
+        for (int round = 0; round < ROUNDS; ++round)
+            check += utf16_to_utf8(units, unit_count, back).written;
+        double from_16 = seconds() - start;
+
+        double bytes = (double) filled * ROUNDS * 1e-9;
+        printf("%-6s  scalar decode %5.2f GB/s  8->32 %5.2f  32->8 %5.2f  8->16 %5.2f  16->8 %5.2f  (%zu)\n",
+               names[kind], bytes / scalar, bytes / to_32, bytes / from_32, bytes / to_16, bytes / from_16, check);
+    }
+    free(text);
+    free(runes);
+    free(units);
+    free(back);
+    return 0;
+}
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+Generates the Unicode property tables in preamble.h (general category, simple
+case mapping and East Asian width) and replaces the generated block between
+the BEGIN/END markers in place.
+
+    python3 scripts/generate_unicode_tables.py --ucd path/to/ucd
+
+`--ucd` is a directory with UnicodeData.txt and EastAsianWidth.txt from
+https://www.unicode.org/Public/<version>/ucd/. Without it the data comes from
+Python's own `unicodedata` module, which is built from the same files; the
+version is whatever that Python was built with.
+
+Every rune maps to a record index through three table stages. The shifts
+between the stages are the ones that make the tables smallest.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RUNE_COUNT = 0x110000
+
+# Must match the order of UnicodeCategory in preamble.h.
+CATEGORIES = [
+    "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+]
+
+# Must match the order of UnicodeWidth in preamble.h.
+WIDTHS = ["N", "A", "H", "W", "F", "Na"]
+
+# Unlisted runes in these ranges default to Wide rather than Neutral.
+DEFAULT_WIDE = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+                (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+BEGIN_MARKER = "/* BEGIN GENERATED UNICODE TABLES */"
+END_MARKER   = "/* END GENERATED UNICODE TABLES */"
+
+
+def parse_range(text):
+    if ".." in text:
+        first, last = text.split("..")
+        return int(first, 16), int(last, 16)
+    return int(text, 16), int(text, 16)
+
+
+def load_ucd(directory):
+    category = ["Cn"] * RUNE_COUNT
+    upper    = list(range(RUNE_COUNT))
+    lower    = list(range(RUNE_COUNT))
+    width    = ["N"] * RUNE_COUNT
+
+    range_start = None
+    with open(os.path.join(directory, "UnicodeData.txt"), encoding="utf-8") as file:
+        for line in file:
+            fields = line.rstrip("\n").split(";")
+            rune = int(fields[0], 16)
+            if fields[1].endswith(", First>"):
+                range_start = rune
+                continue
+            first = range_start if fields[1].endswith(", Last>") else rune
+            range_start = None
+            for r in range(first, rune + 1):
+                category[r] = fields[2]
+            if fields[12]:
+                upper[rune] = int(fields[12], 16)
+            if fields[13]:
+                lower[rune] = int(fields[13], 16)
+
+    for first, last in DEFAULT_WIDE:
+        for r in range(first, last + 1):
+            width[r] = "W"
+    with open(os.path.join(directory, "EastAsianWidth.txt"), encoding="utf-8") as file:
+        for line in file:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            runes, value = [field.strip() for field in line.split(";")]
+            first, last = parse_range(runes)
+            for r in range(first, last + 1):
+                width[r] = value
+
+    version = None
+    with open(os.path.join(directory, "EastAsianWidth.txt"), encoding="utf-8") as file:
+        match = re.search(r"EastAsianWidth-([0-9.]+)\.txt", file.readline())
+        if match:
+            version = match.group(1)
+    return category, upper, lower, width, version or "unknown"
+
+
+def load_python():
+    import unicodedata
+
+    category = ["Cn"] * RUNE_COUNT
+    upper    = list(range(RUNE_COUNT))
+    lower    = list(range(RUNE_COUNT))
+    width    = ["N"] * RUNE_COUNT
+    for rune in range(RUNE_COUNT):
+        c = chr(rune)
+        category[rune] = unicodedata.category(c)
+        width[rune]    = unicodedata.east_asian_width(c)
+        if category[rune] == "Cn":
+            # `unicodedata` doesn't apply the defaults to unassigned runes.
+            width[rune] = "W" if any(first <= rune <= last for first, last in DEFAULT_WIDE) else "N"
+
+        # Python applies the full mappings from SpecialCasing.txt; reduce them
+        # to the simple ones from UnicodeData.txt. Where the full uppercase is
+        # several runes the simple one is the titlecase if that's a single
+        # rune (the Greek iota subscripts), otherwise the rune itself.
+        # U+0130 is the only rune with a multi-rune lowercase.
+        if len(c.upper()) == 1:
+            upper[rune] = ord(c.upper())
+        elif len(c.title()) == 1:
+            upper[rune] = ord(c.title())
+        if len(c.lower()) == 1:
+            lower[rune] = ord(c.lower())
+        elif rune == 0x130:
+            lower[rune] = ord(c.lower()[0])
+    return category, upper, lower, width, unicodedata.unidata_version
+
+
+def split_table(values, shift):
+    """Splits `values` into an index and the distinct blocks of 2^shift entries."""
+    block_size = 1 << shift
+    blocks = {}
+    index = []
+    data = []
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(data) >> shift
+            data.extend(block)
+        index.append(blocks[block])
+    return index, data
+
+
+def table_size(values):
+    return len(values) * integer_size(max(values))
+
+
+def integer_size(maximum):
+    return 1 if maximum < 0x100 else 2 if maximum < 0x10000 else 4
+
+
+def integer_type(maximum):
+    return {1: "u8", 2: "u16", 4: "u32"}[integer_size(maximum)]
+
+
+def format_array(declaration, values, per_line):
+    lines = [declaration + " = {"]
+    width = len(str(max(values)))
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append("    " + ", ".join(str(v).rjust(width) for v in chunk) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate(category, upper, lower, width, version):
+    records = {}
+    record_list = []
+    record_index = []
+    for rune in range(RUNE_COUNT):
+        record = (CATEGORIES.index(category[rune]), WIDTHS.index(width[rune]),
+                  upper[rune] - rune, lower[rune] - rune)
+        if record not in records:
+            records[record] = len(record_list)
+            record_list.append(record)
+        record_index.append(records[record])
+
+    # Three stages: split the record indices once, then split the index of
+    # that split again.
+    best = None
+    for shift_3 in range(1, 10):
+        index_2, stage_3 = split_table(record_index, shift_3)
+        for shift_2 in range(1, 10):
+            stage_1, stage_2 = split_table(index_2, shift_2)
+            size = table_size(stage_1) + table_size(stage_2) + table_size(stage_3)
+            if best is None or size < best[0]:
+                best = (size, shift_2, shift_3, stage_1, stage_2, stage_3)
+    _, shift_2, shift_3, stage_1, stage_2, stage_3 = best
+
+    ascii_category = [CATEGORIES.index(category[rune]) for rune in range(128)]
+
+    out = []
+    out.append(BEGIN_MARKER)
+    out.append("/* Generated by scripts/generate_unicode_tables.py from Unicode %s. Don't edit. */" % version)
+    out.append("#define INTERNAL_UNICODE_VERSION \"%s\"" % version)
+    out.append("#define INTERNAL_UNICODE_SHIFT_2 %d" % shift_2)
+    out.append("#define INTERNAL_UNICODE_SHIFT_3 %d" % shift_3)
+    out.append("")
+    out.append("static const InternalUnicodeRecord INTERNAL_UNICODE_RECORDS[%d] = {" % len(record_list))
+    for c, w, u, l in record_list:
+        out.append("    { %2d, %d, %6d, %6d }," % (c, w, u, l))
+    out.append("};")
+    out.append("")
+    out.append(format_array("static const u8 INTERNAL_UNICODE_ASCII_CATEGORY[128]", ascii_category, 16))
+    out.append("")
+    out.append(format_array("static const %s INTERNAL_UNICODE_STAGE_1[%d]" % (integer_type(max(stage_1)), len(stage_1)), stage_1, 16))
+    out.append("")
+    out.append(format_array("static const %s INTERNAL_UNICODE_STAGE_2[%d]" % (integer_type(max(stage_2)), len(stage_2)), stage_2, 16))
+    out.append("")
+    out.append(format_array("static const %s INTERNAL_UNICODE_STAGE_3[%d]" % (integer_type(max(stage_3)), len(stage_3)), stage_3, 16))
+    out.append(END_MARKER)
+
+    total = (len(record_list) * 12 + 128
+             + len(stage_1) * integer_size(max(stage_1))
+             + len(stage_2) * integer_size(max(stage_2))
+             + len(stage_3) * integer_size(max(stage_3)))
+    print("Unicode %s: %d records, shifts %d/%d, %d bytes of tables"
+          % (version, len(record_list), shift_2, shift_3, total), file=sys.stderr)
+    return "\n".join(out)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--ucd", help="directory with UnicodeData.txt and EastAsianWidth.txt")
+    parser.add_argument("--header", default=os.path.join(root, "preamble.h"))
+    arguments = parser.parse_args()
+
+    data = load_ucd(arguments.ucd) if arguments.ucd else load_python()
+    tables = generate(*data)
+
+    with open(arguments.header, encoding="utf-8") as file:
+        header = file.read()
+    begin = header.index(BEGIN_MARKER)
+    end   = header.index(END_MARKER) + len(END_MARKER)
+    with open(arguments.header, "w", encoding="utf-8") as file:
+        file.write(header[:begin] + tables + header[end:])
+
+
+if __name__ == "__main__":
+    main()
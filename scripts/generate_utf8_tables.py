@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Generates the UTF-8 decoding tables in preamble.h and replaces the generated
+block between the BEGIN/END markers in place.
+
+    python3 scripts/generate_utf8_tables.py
+
+The SIMD decoder looks at 12 bytes at a time. Bit k of its key is set when
+byte k ends a rune, and the key picks a step: the shuffle that spreads the
+leading runes into lanes, and the number of bytes they take. Steps of six
+runes of up to 2 bytes go into 16-bit lanes; otherwise four runes of up to 3
+bytes, or three of up to 4, go into 32-bit lanes. Keys that valid UTF-8 can't
+produce take 0 bytes, which sends the decoder to the scalar code.
+"""
+
+import argparse
+import os
+import sys
+
+BEGIN_MARKER = "/* BEGIN GENERATED UTF-8 TABLES */"
+END_MARKER   = "/* END GENERATED UTF-8 TABLES */"
+
+WINDOW = 12
+ZERO   = 0x80  # A shuffle index that writes a zero byte.
+
+
+def rune_lengths(key):
+    lengths = []
+    start = 0
+    for bit in range(WINDOW):
+        if key >> bit & 1:
+            lengths.append(bit + 1 - start)
+            start = bit + 1
+    return lengths
+
+
+def step_for(key):
+    """Returns (kind, shuffle, consumed); kind 0 has 16-bit lanes."""
+    lengths = rune_lengths(key)
+    for kind, count, longest, lane in ((0, 6, 2, 2), (1, 4, 3, 4), (2, 3, 4, 4)):
+        if len(lengths) < count or max(lengths[:count]) > longest:
+            continue
+        shuffle = [ZERO] * 16
+        start = 0
+        for rune, length in enumerate(lengths[:count]):
+            # Last byte lowest, so the lanes read as little-endian numbers.
+            for byte in range(length):
+                shuffle[rune * lane + byte] = start + length - 1 - byte
+            start += length
+        return kind, tuple(shuffle), start
+    return None
+
+
+def generate():
+    steps = [step_for(key) for key in range(1 << WINDOW)]
+    shuffles = []
+    for kind in range(3):
+        for step in steps:
+            if step and step[0] == kind and step[1] not in shuffles:
+                shuffles.append(step[1])
+        if kind == 0:
+            two_byte_end = len(shuffles)
+        if kind == 1:
+            three_byte_end = len(shuffles)
+
+    table = []
+    for step in steps:
+        table.extend((shuffles.index(step[1]), step[2]) if step else (0, 0))
+
+    out = []
+    out.append(BEGIN_MARKER)
+    out.append("/* Generated by scripts/generate_utf8_tables.py. Don't edit. */")
+    out.append("#define INTERNAL_UTF8_SHUFFLE_TWO_BYTE_END   %d" % two_byte_end)
+    out.append("#define INTERNAL_UTF8_SHUFFLE_THREE_BYTE_END %d" % three_byte_end)
+    out.append("")
+    out.append("static const u8 INTERNAL_UTF8_SHUFFLES[%d][16] = {" % len(shuffles))
+    for shuffle in shuffles:
+        out.append("    { " + ", ".join("0x%02X" % value for value in shuffle) + " },")
+    out.append("};")
+    out.append("")
+    out.append("/* Index into INTERNAL_UTF8_SHUFFLES and bytes consumed, per key. */")
+    out.append("static const u8 INTERNAL_UTF8_STEPS[%d][2] = {" % (1 << WINDOW))
+    for start in range(0, len(table), 16):
+        chunk = table[start:start + 16]
+        pairs = ["{ %3d, %2d }" % (chunk[k], chunk[k + 1]) for k in range(0, len(chunk), 2)]
+        out.append("    " + ", ".join(pairs) + ",")
+    out.append("};")
+    out.append(END_MARKER)
+
+    print("%d shuffles, %d bytes of tables" % (len(shuffles), len(shuffles) * 16 + len(table)),
+          file=sys.stderr)
+    return "\n".join(out)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--header", default=os.path.join(root, "preamble.h"))
+    arguments = parser.parse_args()
+
+    tables = generate()
+
+    with open(arguments.header, encoding="utf-8") as file:
+        header = file.read()
+    begin = header.index(BEGIN_MARKER)
+    end   = header.index(END_MARKER) + len(END_MARKER)
+    with open(arguments.header, "w", encoding="utf-8") as file:
+        file.write(header[:begin] + tables + header[end:])
+
+
+if __name__ == "__main__":
+    main()
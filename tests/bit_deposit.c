@@ -0,0 +1,60 @@
+/* Tests for the BIT DEPOSIT AND EXTRACT section against bit-at-a-time loops.
+    Both the dispatched functions and the software versions are checked, so
+    the SSE4.2 build covers the cpuid path and the AVX2 build the instructions,
+    whatever this CPU picks. */
+#include "test.h"
+
+static u64 naive_deposit(u64 x, u64 mask)
+{
+    u64 result = 0;
+    u32 next   = 0;
+    for (u32 i = 0; i < 64; ++i)
+    {
+        if ((mask >> i) & 1)
+            result |= ((x >> next++) & 1) << i;
+    }
+    return result;
+}
+
+static u64 naive_extract(u64 x, u64 mask)
+{
+    u64 result = 0;
+    u32 next   = 0;
+    for (u32 i = 0; i < 64; ++i)
+    {
+        if ((mask >> i) & 1)
+            result |= ((x >> i) & 1) << next++;
+    }
+    return result;
+}
+
+int main(void)
+{
+    ASSERT(bit_extract_u32(0xABCD, 0x0F0F) == 0xBD && bit_deposit_u32(0xBD, 0x0F0F) == 0x0B0D);
+#if defined(PREAMBLE_NO_SIMD)
+    ASSERT(!bit_has_fast_deposit());
+#endif
+
+    for (usize iteration = 0; iteration < 1000000; ++iteration)
+    {
+        u64 x    = test_random();
+        u64 mask = test_random();
+        if (iteration & 1)
+            mask &= test_random();
+        if (iteration % 3 == 0)
+            mask |= test_random();
+        if (iteration % 7 == 0)
+            mask = ~0ULL;
+        if (iteration % 11 == 0)
+            mask = 0;
+
+        u64 deposited = naive_deposit(x, mask);
+        u64 extracted = naive_extract(x, mask);
+        ASSERT(bit_deposit_u64(x, mask) == deposited && internal_deposit_software(x, mask) == deposited);
+        ASSERT(bit_extract_u64(x, mask) == extracted && internal_extract_software(x, mask) == extracted);
+        ASSERT(bit_deposit_u32((u32) x, (u32) mask) == naive_deposit((u32) x, (u32) mask));
+        ASSERT(bit_extract_u32((u32) x, (u32) mask) == naive_extract((u32) x, (u32) mask));
+        ASSERT(bit_extract_u64(bit_deposit_u64(x, mask), mask) == (x & naive_extract(~0ULL, mask)));
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+/* Tests for the BIT MANIPULATION section against bit-at-a-time loops, on
+    random values of every magnitude plus zero, powers of two and their
+    neighbours, in every width. */
+#include "test.h"
+
+static u32 naive_popcount(u64 x)
+{
+    u32 count = 0;
+    for (; x; x >>= 1)
+        count += (u32) (x & 1);
+    return count;
+}
+
+static u32 naive_clz(u64 x, u32 width)
+{
+    u32 count = 0;
+    while (count < width && !((x >> (width - 1 - count)) & 1))
+        ++count;
+    return count;
+}
+
+static u32 naive_ctz(u64 x, u32 width)
+{
+    u32 count = 0;
+    while (count < width && !((x >> count) & 1))
+        ++count;
+    return count;
+}
+
+/* The smallest power of two >= `x` in `width` bits, or 0. */
+static u64 naive_next_pow2(u64 x, u32 width)
+{
+    for (u32 i = 0; i < width; ++i)
+    {
+        if ((1ULL << i) >= x)
+            return 1ULL << i;
+    }
+    return 0;
+}
+
+static u64 naive_bswap(u64 x, u32 width)
+{
+    u64 swapped = 0;
+    for (u32 i = 0; i < width; i += 8)
+        swapped |= ((x >> i) & 0xFF) << (width - 8 - i);
+    return swapped;
+}
+
+static u64 naive_rotl(u64 x, u32 r, u32 width)
+{
+    u64 mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+    u64 rotated = 0;
+    for (u32 i = 0; i < width; ++i)
+        rotated |= ((x >> i) & 1) << ((i + r) & (width - 1));
+    return rotated & mask;
+}
+
+static u64 interesting_value(usize iteration)
+{
+    u32 shift = (u32) test_random_below(64);
+    switch (iteration & 7)
+    {
+        case 0:  return 0;
+        case 1:  return 1ULL << shift;
+        case 2:  return (1ULL << shift) + 1;
+        case 3:  return (1ULL << shift) - 1;
+        case 4:  return ~0ULL >> shift;
+        default: return test_random() >> shift;
+    }
+}
+
+static void test_intrinsics(void)
+{
+    for (usize iteration = 0; iteration < 1000000; ++iteration)
+    {
+        u64 x   = interesting_value(iteration);
+        u32 r   = (u32) test_random_below(200);
+        u32 x32 = (u32) (x >> (test_random() & 32));
+        u16 x16 = (u16) (x >> (test_random() & 48));
+        u8  x8  = (u8)  (x >> (test_random() & 56));
+
+        ASSERT(bit_popcount_u64(x) == naive_popcount(x) && bit_popcount_u32(x32) == naive_popcount(x32));
+        ASSERT(bit_popcount_u16(x16) == naive_popcount(x16) && bit_popcount_u8(x8) == naive_popcount(x8));
+        ASSERT(bit_clz_u64(x) == naive_clz(x, 64) && bit_clz_u32(x32) == naive_clz(x32, 32));
+        ASSERT(bit_clz_u16(x16) == naive_clz(x16, 16) && bit_clz_u8(x8) == naive_clz(x8, 8));
+        ASSERT(bit_ctz_u64(x) == naive_ctz(x, 64) && bit_ctz_u32(x32) == naive_ctz(x32, 32));
+        ASSERT(bit_ctz_u16(x16) == naive_ctz(x16, 16) && bit_ctz_u8(x8) == naive_ctz(x8, 8));
+
+        ASSERT(bit_bswap_u64(x) == naive_bswap(x, 64) && bit_bswap_u32(x32) == naive_bswap(x32, 32));
+        ASSERT(bit_bswap_u16(x16) == naive_bswap(x16, 16) && bit_bswap_u8(x8) == x8);
+
+        ASSERT(bit_rotl_u64(x, r) == naive_rotl(x, r, 64) && bit_rotl_u32(x32, r) == naive_rotl(x32, r, 32));
+        ASSERT(bit_rotl_u16(x16, r) == naive_rotl(x16, r, 16));
+        ASSERT(bit_rotr_u64(bit_rotl_u64(x, r), r) == x && bit_rotr_u32(bit_rotl_u32(x32, r), r) == x32);
+        ASSERT(bit_rotr_u16(bit_rotl_u16(x16, r), r) == x16);
+
+        ASSERT(bit_is_pow2_u64(x) == (naive_popcount(x) == 1) && bit_is_pow2_u32(x32) == (naive_popcount(x32) == 1));
+        ASSERT(bit_is_pow2_u16(x16) == (naive_popcount(x16) == 1) && bit_is_pow2_u8(x8) == (naive_popcount(x8) == 1));
+        ASSERT(bit_next_pow2_u64(x) == naive_next_pow2(x, 64) && bit_next_pow2_u32(x32) == naive_next_pow2(x32, 32));
+        ASSERT(bit_next_pow2_u16(x16) == naive_next_pow2(x16, 16) && bit_next_pow2_u8(x8) == naive_next_pow2(x8, 8));
+
+        ASSERT(!x || bit_log2_u64(x) == 63 - naive_clz(x, 64));
+        ASSERT(!x32 || bit_log2_u32(x32) == 31 - naive_clz(x32, 32));
+        ASSERT(!x16 || bit_log2_u16(x16) == 15 - naive_clz(x16, 16));
+        ASSERT(!x8 || bit_log2_u8(x8) == 7 - naive_clz(x8, 8));
+    }
+}
+
+static void test_macros(void)
+{
+    u64 x = 0;
+    BIT_SET(x, 63);
+    BIT_SET(x, 3);
+    BIT_FLIP(x, 4);
+    ASSERT(x == (0x8000000000000000ULL | 0x18) && BIT_CHECK(x, 63) && !BIT_CHECK(x, 5));
+    BIT_CLEAR(x, 63);
+    ASSERT(x == 0x18);
+
+    BITMASK_SET(x, 0x300);
+    BITMASK_CLEAR(x, 0x10);
+    BITMASK_FLIP(x, 0x3);
+    ASSERT(x == 0x30B);
+    ASSERT(BITMASK_CHECK_ALL(x, 0x303) && !BITMASK_CHECK_ALL(x, 0x304));
+    ASSERT(BITMASK_CHECK_ANY(x, 0x404) == 0 && BITMASK_CHECK_ANY(x, 0x401));
+}
+
+int main(void)
+{
+    test_intrinsics();
+    test_macros();
+    return 0;
+}
@@ -0,0 +1,97 @@
+/* Tests for the BIT STREAMS section: random fields of every width written and
+    read back through each of the writer and reader entry points, into buffers
+    that are exact, roomy or a byte short, with guard bytes to catch stores
+    past the end. */
+#include "test.h"
+
+#define MAX_FIELDS 3000
+#define GUARD      0xAA
+
+static u64 fields[MAX_FIELDS];
+static u32 widths[MAX_FIELDS];
+static u8  bytes[MAX_FIELDS * 8];
+
+static void test_example(void)
+{
+    u8 buffer[4] = { 0 };
+    BitWriter writer = bit_writer_make(buffer, sizeof(buffer));
+    bit_writer_write(&writer, 5, 3);
+    bit_writer_write(&writer, 1000, 10);
+    ASSERT(bit_writer_finish(&writer) == 2);
+    ASSERT(buffer[0] == 0x45 && buffer[1] == 0x1F);  /* 5 | 1000 << 3, low byte first. */
+
+    BitReader reader = bit_reader_make(buffer, 2);
+    ASSERT(bit_reader_read(&reader, 3) == 5 && bit_reader_read(&reader, 10) == 1000);
+    ASSERT(!bit_reader_overrun(&reader) && bit_reader_remaining(&reader) == 3);
+    ASSERT(bit_reader_read(&reader, 0) == 0 && bit_reader_read(&reader, 8) == 0 && bit_reader_overrun(&reader));
+}
+
+static void test_random_streams(void)
+{
+    for (usize iteration = 0; iteration < 3000; ++iteration)
+    {
+        usize count = test_random_below(MAX_FIELDS);
+        usize bits  = 0;
+        for (usize i = 0; i < count; ++i)
+        {
+            widths[i] = (u32) test_random_below(BIT_STREAM_MAX_BITS + 1);
+            fields[i] = test_random() & ((1ULL << widths[i]) - 1);
+            bits += widths[i];
+        }
+        usize needed       = (bits + 7) / 8;
+        bool  short_by_one = (iteration & 3) == 0 && needed;
+        usize capacity     = short_by_one ? needed - 1 : needed + (iteration % 3) * 8;
+        bool  unchecked    = (iteration & 1) && capacity >= needed + 8;
+        memset(bytes, GUARD, sizeof(bytes));
+
+        /* Bits above the width are ignored. */
+        BitWriter writer = bit_writer_make(bytes, capacity);
+        for (usize i = 0; i < count; ++i)
+        {
+            u64 noisy = fields[i] | (test_random() << widths[i]);
+            if (unchecked)
+                bit_writer_write_unchecked(&writer, noisy, widths[i]);
+            else
+                bit_writer_write(&writer, noisy, widths[i]);
+        }
+        usize size = bit_writer_finish(&writer);
+        if (short_by_one)
+        {
+            ASSERT(size == 0 && bytes[capacity] == GUARD);
+            continue;
+        }
+        ASSERT(size == needed && (capacity > needed || bytes[needed] == GUARD));
+
+        BitReader reader = bit_reader_make(bytes, size);
+        for (usize i = 0; i < count; ++i)
+        {
+            u64 field;
+            if ((iteration & 1) && bit_reader_remaining(&reader) >= (i64) widths[i] + 128)
+            {
+                field = bit_reader_read_unchecked(&reader, widths[i]);
+            }
+            else if (iteration % 3 == 0)
+            {
+                bit_reader_refill(&reader);
+                field = bit_reader_peek(&reader, widths[i]);
+                bit_reader_consume(&reader, widths[i]);
+            }
+            else
+            {
+                field = bit_reader_read(&reader, widths[i]);
+            }
+            ASSERT(field == fields[i]);
+        }
+        usize padding = size * 8 - bits;
+        ASSERT(!bit_reader_overrun(&reader) && bit_reader_remaining(&reader) == (i64) padding);
+        ASSERT(bit_reader_read(&reader, (u32) padding) == 0 && !bit_reader_overrun(&reader));
+        ASSERT(bit_reader_read(&reader, 1) == 0 && bit_reader_overrun(&reader));
+    }
+}
+
+int main(void)
+{
+    test_example();
+    test_random_streams();
+    return 0;
+}
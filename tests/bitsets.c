@@ -0,0 +1,148 @@
+/* Tests for the BITSETS section against arrays of bools, at sizes around
+    word and vector boundaries and well past the sixteen-vector blocks of the
+    Harley-Seal count, for sparse, dense and even sets. */
+#include "test.h"
+
+#define MAX_BITS 20000
+
+static bool expected[MAX_BITS];
+static bool other_bits[MAX_BITS];
+
+static bool random_bit(u32 density)
+{
+    switch (density)
+    {
+        case 0:  return test_random_below(100) == 0;
+        case 1:  return test_random_below(100) != 0;
+        default: return test_random() & 1;
+    }
+}
+
+static void check_matches(const Bitset* set, usize size)
+{
+    usize count = 0;
+    for (usize i = 0; i < size; ++i)
+    {
+        ASSERT(bitset_test(set, i) == expected[i]);
+        count += expected[i];
+    }
+    ASSERT(set->size == size && bitset_count(set) == count);
+
+    BitsetIterator iterator = bitset_iterator_make(set);
+    usize index;
+    usize next = 0;
+    usize seen = 0;
+    while (bitset_iterator_next(&iterator, &index))
+    {
+        while (!expected[next])
+            ++next;
+        ASSERT(index == next);
+        ++next;
+        ++seen;
+    }
+    ASSERT(seen == count);
+
+    usize start = test_random_below(size + 2);
+    usize first = start;
+    while (first < size && !expected[first])
+        ++first;
+    ASSERT(bitset_next(set, start) == (first < size ? first : BITSET_NOT_FOUND));
+}
+
+static void test_random_sets(void)
+{
+    for (usize iteration = 0; iteration < 3000; ++iteration)
+    {
+        usize  size    = (iteration & 3) ? test_random_below(MAX_BITS) : 64 * test_random_below(MAX_BITS / 64) + test_random_below(2);
+        u32    density = (u32) test_random_below(3);
+        Bitset set     = bitset_make(size);
+        Bitset other   = bitset_make(size);
+        for (usize i = 0; i < size; ++i)
+        {
+            expected[i]   = random_bit(density);
+            other_bits[i] = test_random() & 1;
+            if (expected[i])
+                bitset_set(&set, i);
+            if (other_bits[i])
+                bitset_set(&other, i);
+        }
+        for (usize k = 0; size && k < 20; ++k)
+        {
+            usize i = test_random_below(size);
+            if (k & 1)
+                bitset_flip(&set, i);
+            else
+                bitset_clear(&set, i);
+            expected[i] = (k & 1) ? !expected[i] : false;
+        }
+
+        switch (iteration % 5)
+        {
+            case 0:
+                bitset_and(&set, &other);
+                for (usize i = 0; i < size; ++i)
+                    expected[i] = expected[i] && other_bits[i];
+                break;
+            case 1:
+                bitset_or(&set, &other);
+                for (usize i = 0; i < size; ++i)
+                    expected[i] = expected[i] || other_bits[i];
+                break;
+            case 2:
+                bitset_xor(&set, &other);
+                for (usize i = 0; i < size; ++i)
+                    expected[i] = expected[i] != other_bits[i];
+                break;
+            case 3:
+                bitset_andnot(&set, &other);
+                for (usize i = 0; i < size; ++i)
+                    expected[i] = expected[i] && !other_bits[i];
+                break;
+            default:
+                break;
+        }
+        check_matches(&set, size);
+
+        /* Growing adds zeros; shrinking drops bits for good. */
+        usize resized = test_random_below(MAX_BITS);
+        ASSERT(bitset_resize(&set, resized));
+        for (usize i = size; i < resized; ++i)
+            expected[i] = false;
+        check_matches(&set, resized);
+
+        bitset_set_all(&set);
+        ASSERT(bitset_count(&set) == resized);
+        ASSERT(bitset_resize(&set, resized / 2) && bitset_resize(&set, resized));
+        ASSERT(bitset_count(&set) == resized / 2 && bitset_next(&set, resized / 2) == BITSET_NOT_FOUND);
+        bitset_clear_all(&set);
+        ASSERT(bitset_count(&set) == 0 && bitset_next(&set, 0) == BITSET_NOT_FOUND);
+
+        bitset_free(&set);
+        bitset_free(&other);
+        ASSERT(!set.words && !set.size);
+    }
+}
+
+static void test_fixed_storage(void)
+{
+    u64    storage[BITSET_WORD_COUNT(100)] = { 0 };
+    Bitset set = bitset_from_words(storage, 100);
+    bitset_set(&set, 99);
+    ASSERT(storage[1] == 1ULL << 35 && bitset_count(&set) == 1);
+    ASSERT(!bitset_resize(&set, 200) && set.size == 100);
+    ASSERT(bitset_resize(&set, 128) && bitset_resize(&set, 64) && storage[1] == 0);
+    bitset_free(&set);
+
+    Bitset empty = bitset_make(0);
+    BitsetIterator iterator = bitset_iterator_make(&empty);
+    usize index;
+    ASSERT(!bitset_iterator_next(&iterator, &index) && bitset_count(&empty) == 0);
+    bitset_free(&empty);
+}
+
+int main(void)
+{
+    test_random_sets();
+    test_fixed_storage();
+    return 0;
+}
@@ -0,0 +1,101 @@
+/* Tests for the BYTE SETS, SPLITTING AND TOKENIZING section, checked against
+    a 256-entry table on random strings whose lengths straddle the 64-byte
+    blocks and random sets on both sides of the three-byte direct compare. */
+#include "test.h"
+
+static const char COMMON_BYTES[] = "abc,;\n \t\x80\xff";
+
+static void test_examples(void)
+{
+    StringSplitter splitter = string_splitter_make(STR("a,,b"), STR(","));
+    String piece;
+    ASSERT(string_splitter_next(&splitter, &piece) && string_equals(piece, STR("a")));
+    ASSERT(string_splitter_next(&splitter, &piece) && string_equals(piece, STR("")));
+    ASSERT(string_splitter_next(&splitter, &piece) && string_equals(piece, STR("b")));
+    ASSERT(!string_splitter_next(&splitter, &piece));
+
+    StringTokenizer tokenizer = string_tokenizer_make(STR("  to be\t\n or "), STRING_WHITESPACE);
+    ASSERT(string_tokenizer_next(&tokenizer, &piece) && string_equals(piece, STR("to")));
+    ASSERT(string_tokenizer_next(&tokenizer, &piece) && string_equals(piece, STR("be")));
+    ASSERT(string_tokenizer_next(&tokenizer, &piece) && string_equals(piece, STR("or")));
+    ASSERT(!string_tokenizer_next(&tokenizer, &piece) && !string_tokenizer_next(&tokenizer, &piece));
+
+    ASSERT(string_find_any(STR("hello, world"), STR(" ,")) == 5);
+    ASSERT(string_find_any(STR("hello"), STR("")) == STRING_NOT_FOUND);
+    ASSERT(string_find_any(STR(""), STR("abc")) == STRING_NOT_FOUND);
+}
+
+static void test_random_strings(void)
+{
+    static u8 text[1000];
+    u8 members[20];
+    for (usize iteration = 0; iteration < 200000; ++iteration)
+    {
+        usize size  = test_random_below(300);
+        usize count = (iteration & 63) == 0 ? test_random_below(20) : test_random_below(8);
+        for (usize i = 0; i < count; ++i)
+            members[i] = (test_random() & 1) ? (u8) test_random() : (u8) COMMON_BYTES[test_random_below(10)];
+        for (usize i = 0; i < size; ++i)
+            text[i] = (count && test_random_below(8) == 0) ? members[test_random_below(count)] : (u8) test_random();
+
+        String string = string_make((const utf8*) text, size);
+        String bytes  = string_make((const utf8*) members, count);
+        bool in_set[256] = { false };
+        for (usize i = 0; i < count; ++i)
+            in_set[members[i]] = true;
+
+        ByteSet set = byte_set_make(bytes);
+        for (u32 byte = 0; byte < 256; ++byte)
+            ASSERT(byte_set_contains(&set, (u8) byte) == in_set[byte]);
+
+        usize expected = STRING_NOT_FOUND;
+        for (usize i = 0; i < size && expected == STRING_NOT_FOUND; ++i)
+        {
+            if (in_set[text[i]])
+                expected = i;
+        }
+        ASSERT(string_find_any(string, bytes) == expected && string_find_set(string, &set) == expected);
+
+        /* Every piece runs from just past one delimiter to the next. */
+        StringSplitter splitter = string_splitter_make(string, bytes);
+        String piece;
+        usize start = 0;
+        while (string_splitter_next(&splitter, &piece))
+        {
+            usize end = start;
+            while (end < size && !in_set[text[end]])
+                ++end;
+            ASSERT(piece.data == (const utf8*) text + start && piece.size == end - start);
+            start = end + 1;
+        }
+        ASSERT(start == size + 1);
+
+        /* Tokens are the maximal runs of non-separators. */
+        StringTokenizer tokenizer = string_tokenizer_make(string, bytes);
+        usize position = 0;
+        for (;;)
+        {
+            while (position < size && in_set[text[position]])
+                ++position;
+            bool found = string_tokenizer_next(&tokenizer, &piece);
+            if (position == size)
+            {
+                ASSERT(!found);
+                break;
+            }
+            usize end = position;
+            while (end < size && !in_set[text[end]])
+                ++end;
+            ASSERT(found && piece.data == (const utf8*) text + position && piece.size == end - position);
+            position = end;
+        }
+        ASSERT(!string_tokenizer_next(&tokenizer, &piece));
+    }
+}
+
+int main(void)
+{
+    test_examples();
+    test_random_strings();
+    return 0;
+}
@@ -0,0 +1,245 @@
+/* Round-trip tests for format_f64 and format_f32. Every output must read back
+    through strtod/strtof as the same value, and have the digits of the
+    shortest decimal that does, picking the closest when there are several.
+    Covers random bit patterns, subnormals, every power of two and exact
+    decimals ending in 5, where rounding ties. */
+#include "test.h"
+#include <math.h>
+#include <stdlib.h>
+
+/* Significant digits without leading or trailing zeros, as 0.DIGITS x 10^exponent. */
+typedef struct Decimal {
+    char digits[48];
+    int  count;
+    int  exponent;
+} Decimal;
+
+static Decimal parse_decimal(const char* text)
+{
+    Decimal decimal;
+    memset(&decimal, 0, sizeof(decimal));
+    bool after_point = false;
+    for (; *text && *text != 'e'; ++text)
+    {
+        if (*text == '.')
+            after_point = true;
+        else if (*text < '0' || *text > '9')
+            continue;
+        else if (decimal.count == 0 && *text == '0')
+            decimal.exponent -= after_point;
+        else
+        {
+            decimal.digits[decimal.count++] = *text;
+            decimal.exponent += !after_point;
+        }
+    }
+    if (*text == 'e')
+        decimal.exponent += atoi(text + 1);
+    while (decimal.count && decimal.digits[decimal.count - 1] == '0')
+        decimal.count -= 1;
+    return decimal;
+}
+
+static bool decimal_equals(Decimal a, Decimal b)
+{
+    return a.count == b.count && a.exponent == b.exponent && memcmp(a.digits, b.digits, (usize) a.count) == 0;
+}
+
+static bool reads_back(const char* text, f64 value, bool single)
+{
+    return single ? strtof(text, 0) == (f32) value : strtod(text, 0) == value;
+}
+
+/* The shortest decimal that reads back as `value`, written as DIGITSeEXPONENT.
+    At each length the correctly rounded "%.*e" is the closest candidate, but
+    next to a power of two, where the lower bound is nearer, it may fall
+    outside and the next decimal up be the one that reads back. */
+static void shortest(f64 value, bool single, char* text, usize capacity)
+{
+    for (int precision = 1; precision <= 17; ++precision)
+    {
+        char rounded[64];
+        snprintf(rounded, sizeof(rounded), "%.*e", precision - 1, fabs(value));
+        u64 digits = 0;
+        for (const char* c = rounded; *c != 'e'; ++c)
+        {
+            if (*c != '.')
+                digits = digits * 10 + (u64) (*c - '0');
+        }
+        int exponent = atoi(strchr(rounded, 'e') + 1) - (precision - 1);
+        for (int step = 0; step < 3; ++step)
+        {
+            u64 candidate = step == 0 ? digits : step == 1 ? digits + 1 : digits - 1;
+            snprintf(text, capacity, "%s%llue%d", value < 0 ? "-" : "", (unsigned long long) candidate, exponent);
+            if (reads_back(text, value, single))
+                return;
+        }
+    }
+    ASSERTF(false, "No decimal reads back as %.17g.", value);
+}
+
+static void check_f64(f64 value)
+{
+    if (isnan(value) || isinf(value))
+        return;
+    char text[FORMAT_F64_MAX_SIZE + 1];
+    usize size = format_f64(text, value);
+    ASSERT(size < FORMAT_F64_MAX_SIZE);
+    text[size] = '\0';
+    ASSERTF(strtod(text, 0) == value && signbit(strtod(text, 0)) == signbit(value), "%s reads back wrong.", text);
+    if (value == 0)
+        return;
+
+    char expected[64];
+    shortest(value, false, expected, sizeof(expected));
+    ASSERTF(decimal_equals(parse_decimal(text), parse_decimal(expected)), "%s isn't the shortest, %s.", text, expected);
+}
+
+static void check_f32(f32 value)
+{
+    if (isnan(value) || isinf(value))
+        return;
+    char text[FORMAT_F32_MAX_SIZE + 1];
+    usize size = format_f32(text, value);
+    ASSERT(size < FORMAT_F32_MAX_SIZE);
+    text[size] = '\0';
+    ASSERTF(strtof(text, 0) == value && signbit(strtof(text, 0)) == signbit(value), "%s reads back wrong.", text);
+    if (value == 0)
+        return;
+
+    char expected[64];
+    shortest(value, true, expected, sizeof(expected));
+    ASSERTF(decimal_equals(parse_decimal(text), parse_decimal(expected)), "%s isn't the shortest, %s.", text, expected);
+}
+
+static f64 f64_from_bits(u64 bits)
+{
+    f64 value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static f32 f32_from_bits(u32 bits)
+{
+    f32 value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void check_text(f64 value, const char* expected)
+{
+    char text[FORMAT_F64_MAX_SIZE];
+    usize size = format_f64(text, value);
+    ASSERTF(size == strlen(expected) && memcmp(text, expected, size) == 0, "Wanted %s.", expected);
+}
+
+static void test_notation(void)
+{
+    check_text(0.1, "0.1");
+    check_text(0.3, "0.3");
+    check_text(100, "100");
+    check_text(123.25, "123.25");
+    check_text(-0.0, "-0");
+    check_text(1e21, "1e+21");
+    check_text(1e20, "100000000000000000000");
+    check_text(0.000015, "0.000015");
+    check_text(1.5e-7, "1.5e-7");
+    check_text(5e-324, "5e-324");
+    check_text(1.7976931348623157e308, "1.7976931348623157e+308");
+    check_text(INFINITY, "inf");
+    check_text(-INFINITY, "-inf");
+    check_text(NAN, "nan");
+
+    char text[FORMAT_F32_MAX_SIZE];
+    usize size = format_f32(text, 0.1f);
+    ASSERT(size == 3 && memcmp(text, "0.1", 3) == 0);
+    size = format_f32(text, 16777216.0f);
+    ASSERT(size == 8 && memcmp(text, "16777216", 8) == 0);
+}
+
+static void test_random_bits(void)
+{
+    for (usize round = 0; round < 100000; ++round)
+    {
+        u64 bits = test_random();
+        if (round & 1)  /* Exponents near 1, where fixed notation is used. */
+            bits = (bits & 0x800FFFFFFFFFFFFFULL) | ((u64) (1023 - 40 + test_random_below(80)) << 52);
+        if (round % 7 == 0)  /* Short mantissas, which leave trailing zeros. */
+            bits &= ~0xFFFFFFFFULL;
+        check_f64(f64_from_bits(bits));
+
+        u32 bits_32 = (u32) test_random();
+        if (round % 5 == 0)
+            bits_32 &= ~0xFFu;
+        check_f32(f32_from_bits(bits_32));
+    }
+}
+
+static void test_subnormals(void)
+{
+    for (u64 mantissa = 1; mantissa < 2000; ++mantissa)
+    {
+        check_f64(f64_from_bits(mantissa));
+        check_f64(f64_from_bits(0x000FFFFFFFFFFFFFULL - mantissa));
+        check_f32(f32_from_bits((u32) mantissa));
+        check_f32(f32_from_bits(0x007FFFFFu - (u32) mantissa));
+    }
+    for (usize round = 0; round < 20000; ++round)
+    {
+        check_f64(f64_from_bits(test_random() & 0x800FFFFFFFFFFFFFULL));
+        check_f32(f32_from_bits((u32) test_random() & 0x807FFFFFu));
+    }
+}
+
+static void test_powers_of_two(void)
+{
+    /* The lower rounding bound is closer at a power of two. */
+    for (int exponent = -1074; exponent <= 1023; ++exponent)
+    {
+        f64 value = ldexp(1.0, exponent);
+        check_f64(value);
+        check_f64(-value);
+        if (value < 1.7976931348623157e308)
+            check_f64(nextafter(value, INFINITY));
+        check_f64(nextafter(value, 0));
+    }
+    for (int exponent = -149; exponent <= 127; ++exponent)
+    {
+        f32 value = ldexpf(1.0f, exponent);
+        check_f32(value);
+        check_f32(nextafterf(value, INFINITY));
+        check_f32(nextafterf(value, 0));
+    }
+}
+
+static void test_ties(void)
+{
+    /* Dyadic values are exact decimals ending in 5, so the shortest output
+        often has to break a tie between two candidates. */
+    for (u32 mantissa = 1; mantissa < 4000; mantissa += 2)
+    {
+        for (int shift = 1; shift <= 24; ++shift)
+        {
+            check_f64(ldexp((f64) mantissa, -shift));
+            check_f32(ldexpf((f32) mantissa, -shift));
+        }
+    }
+    /* Odd multiples of 5 and their neighbours, where the last digit rounds. */
+    for (u64 value = 5; value < (1ULL << 54); value = value * 3 + 10)
+    {
+        check_f64((f64) value);
+        check_f64(nextafter((f64) value, 0));
+        check_f32((f32) value);
+        check_f32(nextafterf((f32) value, 0));
+    }
+}
+
+int main(void)
+{
+    test_notation();
+    test_random_bits();
+    test_subnormals();
+    test_powers_of_two();
+    test_ties();
+    return 0;
+}
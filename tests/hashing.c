@@ -0,0 +1,145 @@
+/* Tests for the HASHING section. `hash_bytes` must be wyhash final4 bit for
+    bit, so it's checked against the test vectors from the wyhash repository
+    and a digest over every length up to 200 computed with a transcription of
+    the reference code; the streaming hasher must agree with it for any way of
+    cutting the input; and the integer mixers must avalanche. */
+#include "test.h"
+
+typedef struct KnownHash {
+    const char* message;
+    u64         hash;  /* wyhash(message, strlen(message), seed = row index, _wyp) */
+} KnownHash;
+
+static const KnownHash WYHASH_VECTORS[] = {
+    { "", 0x93228A4DE0EEC5A2ULL },
+    { "a", 0xC5BAC3DB178713C4ULL },
+    { "abc", 0xA97F2F7B1D9B3314ULL },
+    { "message digest", 0x786D1F1DF3801DF4ULL },
+    { "abcdefghijklmnopqrstuvwxyz", 0xDCA5A8138AD37C87ULL },
+    { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 0xB9E734F117CFAF70ULL },
+    { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0x6CC5EAB49A92D617ULL },
+};
+
+/* FNV-1a over the hashes of bytes (7k + 3) & 255 of lengths 0 to 200, seed
+    0x0123456789ABCDEF, which runs every branch of the reference code. */
+#define WYHASH_LENGTHS_DIGEST 0x4170BAAD556B68FDULL
+
+static void test_known_answers(void)
+{
+    for (usize i = 0; i < ARRAY_COUNT(WYHASH_VECTORS); ++i)
+    {
+        const char* message = WYHASH_VECTORS[i].message;
+        u64 hash = hash_bytes(message, strlen(message), i);
+        ASSERTF(hash == WYHASH_VECTORS[i].hash, "\"%s\": 0x%016llX", message, (unsigned long long) hash);
+    }
+    ASSERT(hash_string(STR("abc")) == hash_bytes("abc", 3, 0));
+
+    u8  bytes[200];
+    u64 digest = 0xCBF29CE484222325ULL;
+    for (usize i = 0; i < sizeof(bytes); ++i)
+        bytes[i] = (u8) (i * 7 + 3);
+    for (usize size = 0; size <= sizeof(bytes); ++size)
+        digest = (digest ^ hash_bytes(bytes, size, 0x0123456789ABCDEFULL)) * 0x100000001B3ULL;
+    ASSERTF(digest == WYHASH_LENGTHS_DIGEST, "Digest 0x%016llX.", (unsigned long long) digest);
+}
+
+static void test_streaming(void)
+{
+    static u8 bytes[600];
+    for (usize i = 0; i < sizeof(bytes); ++i)
+        bytes[i] = (u8) test_random();
+
+    for (usize iteration = 0; iteration < 100000; ++iteration)
+    {
+        usize  size    = test_random_below(sizeof(bytes));
+        u64    seed    = (iteration & 1) ? test_random() : 0;
+        usize  longest = (iteration & 3) == 0 ? 5 : 100;
+        Hasher hasher  = hasher_make(seed);
+        for (usize offset = 0; offset < size;)
+        {
+            usize chunk = test_random_below(longest);
+            if (chunk > size - offset)
+                chunk = size - offset;
+            hasher_update(&hasher, bytes + offset, chunk);
+            offset += chunk;
+            if (test_random_below(16) == 0)
+                ASSERT(hasher_finish(&hasher) == hash_bytes(bytes, offset, seed));
+        }
+        ASSERT(hasher_finish(&hasher) == hash_bytes(bytes, size, seed));
+    }
+}
+
+/* Flipping any input bit flips each output bit with probability 1/2, to
+    within `tolerance`. The noise on each of the bits x bits estimates is
+    about 0.5 / sqrt(trials). */
+#define CHECK_AVALANCHE(type, bits, mix, trials, tolerance)                       \
+    do                                                                            \
+    {                                                                             \
+        static u32 flips[bits][bits];                                             \
+        memset(flips, 0, sizeof(flips));                                          \
+        for (usize trial = 0; trial < (trials); ++trial)                          \
+        {                                                                         \
+            type input = (type) test_random();                                    \
+            type hash  = mix(input);                                              \
+            for (u32 in = 0; in < (bits); ++in)                                   \
+            {                                                                     \
+                type flipped = hash ^ mix((type) (input ^ ((type) 1 << in)));      \
+                for (u32 out = 0; out < (bits); ++out)                            \
+                    flips[in][out] += (u32) (flipped >> out) & 1;                 \
+            }                                                                     \
+        }                                                                         \
+        for (u32 in = 0; in < (bits); ++in)                                       \
+        {                                                                         \
+            for (u32 out = 0; out < (bits); ++out)                                \
+            {                                                                     \
+                double bias = fabs((double) flips[in][out] / (trials) - 0.5);     \
+                ASSERTF(bias < (tolerance), #mix ": input bit %u, output bit %u, bias %.4f", in, out, bias); \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+    while (0)
+
+/* Over consecutive keys, the common case for table indices, each output bit
+    is set half the time. */
+#define CHECK_BIT_BIAS(type, bits, mix, count, tolerance)                         \
+    do                                                                            \
+    {                                                                             \
+        u32 ones[bits] = { 0 };                                                   \
+        for (usize key = 0; key < (count); ++key)                                 \
+        {                                                                         \
+            type hash = mix((type) key);                                          \
+            for (u32 out = 0; out < (bits); ++out)                                \
+                ones[out] += (u32) (hash >> out) & 1;                             \
+        }                                                                         \
+        for (u32 out = 0; out < (bits); ++out)                                    \
+        {                                                                         \
+            double bias = fabs((double) ones[out] / (count) - 0.5);              \
+            ASSERTF(bias < (tolerance), #mix ": output bit %u, bias %.4f", out, bias); \
+        }                                                                         \
+    }                                                                             \
+    while (0)
+
+static u64 hash_bytes_u64(u64 key)
+{
+    return hash_bytes(&key, sizeof(key), 0);
+}
+
+static void test_mixers(void)
+{
+    CHECK_AVALANCHE(u32, 32, hash_u32, 100000, 0.01);
+    CHECK_AVALANCHE(u64, 64, hash_u64, 100000, 0.01);
+    CHECK_AVALANCHE(u64, 64, hash_bytes_u64, 20000, 0.02);
+    CHECK_BIT_BIAS(u32, 32, hash_u32, 1u << 20, 0.005);
+    CHECK_BIT_BIAS(u64, 64, hash_u64, 1u << 20, 0.005);
+    CHECK_BIT_BIAS(u64, 64, hash_bytes_u64, 1u << 20, 0.005);
+
+    ASSERT(hash_combine(hash_combine(0, 1), 2) != hash_combine(hash_combine(0, 2), 1));
+}
+
+int main(void)
+{
+    test_known_answers();
+    test_streaming();
+    test_mixers();
+    return 0;
+}
@@ -0,0 +1,86 @@
+/* Tests for the UNALIGNED LOADS AND STORES section: loads at every offset
+    against assembling the bytes by hand, stores that touch exactly their own
+    bytes, and the compile-time byte order against the one at run time. */
+#include "test.h"
+
+#define BUFFER_SIZE 64
+
+static u64 naive_load(const u8* bytes, u32 size, bool big_endian)
+{
+    u64 value = 0;
+    for (u32 i = 0; i < size; ++i)
+        value |= (u64) bytes[big_endian ? size - 1 - i : i] << (i * 8);
+    return value;
+}
+
+static void test_loads(void)
+{
+    u8 bytes[BUFFER_SIZE];
+    for (usize round = 0; round < 1000; ++round)
+    {
+        for (usize i = 0; i < BUFFER_SIZE; ++i)
+            bytes[i] = (u8) test_random();
+        for (usize offset = 0; offset + 8 <= BUFFER_SIZE; ++offset)
+        {
+            const u8* at = bytes + offset;
+            ASSERT(load_le16(at) == naive_load(at, 2, false) && load_be16(at) == naive_load(at, 2, true));
+            ASSERT(load_le32(at) == naive_load(at, 4, false) && load_be32(at) == naive_load(at, 4, true));
+            ASSERT(load_le64(at) == naive_load(at, 8, false) && load_be64(at) == naive_load(at, 8, true));
+        }
+    }
+
+    const u8 packet[8] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    ASSERT(load_be32(packet) == 0x01020304 && load_le32(packet) == 0x04030201);
+    ASSERT(load_be64(packet) == 0x0102030405060708ULL && load_le16(packet + 1) == 0x0302);
+}
+
+#define CHECK_STORE(store, load, type, big_endian)                                        \
+    do                                                                                    \
+    {                                                                                     \
+        type value = (type) test_random();                                                \
+        memset(bytes, 0xEE, sizeof(bytes));                                               \
+        store(bytes + offset, value);                                                     \
+        ASSERT(load(bytes + offset) == value);                                            \
+        ASSERT(naive_load(bytes + offset, sizeof(type), big_endian) == value);            \
+        for (usize i = 0; i < BUFFER_SIZE; ++i)                                           \
+            ASSERT((i >= offset && i < offset + sizeof(type)) || bytes[i] == 0xEE);       \
+    }                                                                                     \
+    while (0)
+
+static void test_stores(void)
+{
+    u8 bytes[BUFFER_SIZE];
+    for (usize round = 0; round < 1000; ++round)
+    {
+        for (usize offset = 0; offset + 8 <= BUFFER_SIZE; ++offset)
+        {
+            CHECK_STORE(store_le16, load_le16, u16, false);
+            CHECK_STORE(store_le32, load_le32, u32, false);
+            CHECK_STORE(store_le64, load_le64, u64, false);
+            CHECK_STORE(store_be16, load_be16, u16, true);
+            CHECK_STORE(store_be32, load_be32, u32, true);
+            CHECK_STORE(store_be64, load_be64, u64, true);
+        }
+    }
+}
+
+static void test_byte_order(void)
+{
+    u32 probe = 1;
+    u8  first;
+    memcpy(&first, &probe, 1);
+#if INTERNAL_BIG_ENDIAN
+    ASSERT(first == 0);
+#else
+    ASSERT(first == 1);
+#endif
+    ASSERT(load_le32(&probe) == (first ? 1u : 0x01000000u));
+}
+
+int main(void)
+{
+    test_loads();
+    test_stores();
+    test_byte_order();
+    return 0;
+}
@@ -0,0 +1,122 @@
+/* Tests for the MEMORY and MEMORY STATISTICS sections: arenas and pools on
+    every kind of page, and what they report. */
+#include "preamble.h"
+
+static void test_arena(MemoryPages requested)
+{
+    Arena arena = arena_make(GIGABYTES(4), requested);
+    ASSERT(arena.base);
+    ASSERT(arena.pages <= requested);
+    ASSERT(arena.reserved >= GIGABYTES(4));
+
+    /* Fresh memory is zeroed, and every push is aligned. */
+    usize count = 1000000;
+    u64*  words = ARENA_PUSH_ARRAY(&arena, u64, count);
+    ASSERT(words && ((uintptr_t) words & (ALIGNOF(u64) - 1)) == 0);
+    for (usize i = 0; i < count; ++i)
+    {
+        ASSERT(words[i] == 0);
+        words[i] = i;
+    }
+    u8*  byte  = (u8*) arena_push(&arena, 3, 1);
+    u32* value = ARENA_PUSH_TYPE(&arena, u32);
+    ASSERT(byte && value && ((uintptr_t) value & 3) == 0);
+    ASSERT(arena_push(&arena, 0, 4096) && (arena.used & 4095) == 0);
+    ASSERT(arena.committed >= arena.used && arena.high_water == arena.used);
+
+    /* Pushes past the reservation fail without moving the arena. */
+    usize used = arena.used;
+    ASSERT(arena_push(&arena, GIGABYTES(8), 1) == 0);
+    ASSERT(arena_push(&arena, (usize) -1, 1) == 0);
+    ASSERT(arena.used == used);
+
+    /* A reset keeps the memory and the high-water mark. */
+    arena_reset(&arena);
+    ASSERT(arena.used == 0 && arena.high_water == used);
+    ASSERT(ARENA_PUSH_ARRAY(&arena, u64, count) == words && words[count - 1] == count - 1);
+
+    arena_free(&arena);
+    ASSERT(!arena.base && !arena.reserved);
+}
+
+static void test_pool(MemoryPages requested)
+{
+    Pool pool = pool_make(24, MEGABYTES(64), requested);
+    ASSERT(pool.arena.base);
+    ASSERT(pool.block_size >= 24 && (pool.block_size & (MEMORY_DEFAULT_ALIGNMENT - 1)) == 0);
+
+    void* blocks[100];
+    for (usize i = 0; i < 100; ++i)
+    {
+        blocks[i] = pool_alloc(&pool);
+        ASSERT(blocks[i] && ((uintptr_t) blocks[i] & (MEMORY_DEFAULT_ALIGNMENT - 1)) == 0);
+        ASSERT(i == 0 || blocks[i] != blocks[i - 1]);
+        memset(blocks[i], 0xAB, 24);
+    }
+    ASSERT(pool.blocks_in_use == 100 && pool.blocks_high_water == 100);
+
+    /* Released blocks come back last in, first out. */
+    pool_release(&pool, blocks[10]);
+    pool_release(&pool, blocks[20]);
+    ASSERT(pool.blocks_in_use == 98);
+    ASSERT(pool_alloc(&pool) == blocks[20]);
+    ASSERT(pool_alloc(&pool) == blocks[10]);
+    ASSERT(pool.blocks_in_use == 100 && pool.blocks_high_water == 100);
+
+    pool_free(&pool);
+    ASSERT(!pool.arena.base && !pool.free_list);
+}
+
+static void test_stats(void)
+{
+    Arena arena = arena_make(MEGABYTES(64), MEMORY_PAGES_NORMAL);
+    arena_push(&arena, 100000, 8);
+    arena_reset(&arena);
+    arena_push(&arena, 10, 8);
+
+    Pool  pool  = pool_make(32, MEGABYTES(1), MEMORY_PAGES_NORMAL);
+    void* first = pool_alloc(&pool);
+    pool_alloc(&pool);
+    pool_release(&pool, first);
+
+    MemoryStats arena_only = arena_stats(&arena);
+    ASSERT(arena_only.reserved == MEGABYTES(64) && arena_only.committed >= 100000);
+    ASSERT(arena_only.used == 10 && arena_only.high_water == 100000 && arena_only.resident == 0);
+
+    MemoryStats stats = memory_stats();
+    memory_stats_add(&stats, arena_stats(&arena));
+    memory_stats_add(&stats, pool_stats(&pool));
+    ASSERT(stats.reserved == MEGABYTES(64) + MEGABYTES(1));
+    ASSERT(stats.used == 10 + 32 && stats.high_water == 100000 + 64);
+
+    char line[256];
+    snprintf(line, sizeof(line), MEMORY_STATS_FORMAT, MEMORY_STATS_ARGS(stats));
+    ASSERT(strstr(line, "used=42 high_water=100064"));
+
+#if OS_IS_LINUX
+    /* Touching 32 MiB shows up in the resident set. */
+    ASSERT(stats.resident > 0);
+    u8* bytes = (u8*) arena_push(&arena, MEGABYTES(32), 1);
+    for (usize i = 0; i < MEGABYTES(32); i += 4096)
+        bytes[i] = 1;
+    ASSERT(memory_stats().resident >= stats.resident + MEGABYTES(16));
+#endif
+
+    arena_free(&arena);
+    pool_free(&pool);
+}
+
+STATIC_ASSERT(IS_POWER_OF_TWO(64) && !IS_POWER_OF_TWO(0) && !IS_POWER_OF_TWO(96));
+STATIC_ASSERT(ALIGN_UP(13, 8) == 16 && ALIGN_DOWN(13, 8) == 8 && ALIGN_UP(16, 8) == 16);
+
+int main(void)
+{
+    MemoryPages kinds[] = { MEMORY_PAGES_NORMAL, MEMORY_PAGES_HUGE_TRANSPARENT, MEMORY_PAGES_HUGE_EXPLICIT };
+    for (usize i = 0; i < ARRAY_COUNT(kinds); ++i)
+    {
+        test_arena(kinds[i]);
+        test_pool(kinds[i]);
+    }
+    test_stats();
+    return 0;
+}
@@ -0,0 +1,91 @@
+/* Tests for the MORTON CODES section against interleaving one bit at a time:
+    the single-value versions in both widths, the magic-number helpers on their
+    own (the AVX2 build would otherwise only run pdep and pext), and the batch
+    versions on counts that aren't a multiple of any vector width. */
+#include "test.h"
+
+#define BATCH_SIZE 1003
+
+/* Bit b of coordinate d goes to bit b * dimensions + d, up to `bits` each. */
+static u64 naive_interleave(const u32* coordinates, u32 dimensions, u32 bits)
+{
+    u64 code = 0;
+    for (u32 b = 0; b < bits; ++b)
+    {
+        for (u32 d = 0; d < dimensions; ++d)
+            code |= (u64) ((coordinates[d] >> b) & 1) << (b * dimensions + d);
+    }
+    return code;
+}
+
+static void test_single_values(void)
+{
+    ASSERT(morton_encode_2d_u64(1, 0) == 1 && morton_encode_2d_u64(0, 1) == 2 && morton_encode_3d_u64(0, 0, 1) == 4);
+
+    for (usize iteration = 0; iteration < 200000; ++iteration)
+    {
+        u32 c[3] = { (u32) test_random(), (u32) test_random(), (u32) test_random() };
+        u32 x, y, z;
+        u16 x16, y16;
+
+        u64 code = naive_interleave(c, 2, 32);
+        ASSERT(morton_encode_2d_u64(c[0], c[1]) == code);
+        morton_decode_2d_u64(code, &x, &y);
+        ASSERT(x == c[0] && y == c[1]);
+        ASSERT((internal_morton_spread_2d(c[0]) | internal_morton_spread_2d(c[1]) << 1) == code);
+        ASSERT(internal_morton_compact_2d(code) == c[0] && internal_morton_compact_2d(code >> 1) == c[1]);
+
+        u32 c21[3] = { c[0] & 0x1FFFFF, c[1] & 0x1FFFFF, c[2] & 0x1FFFFF };
+        code = naive_interleave(c21, 3, 21);
+        ASSERT(morton_encode_3d_u64(c[0], c[1], c[2]) == code);
+        morton_decode_3d_u64(code | (1ULL << 63), &x, &y, &z);
+        ASSERT(x == c21[0] && y == c21[1] && z == c21[2]);
+        ASSERT((internal_morton_spread_3d(c[0]) | internal_morton_spread_3d(c[1]) << 1 | internal_morton_spread_3d(c[2]) << 2) == code);
+        ASSERT(internal_morton_compact_3d(code >> 1) == c21[1]);
+
+        u32 c16[2] = { (u16) c[0], (u16) c[1] };
+        code = naive_interleave(c16, 2, 16);
+        ASSERT(morton_encode_2d_u32((u16) c[0], (u16) c[1]) == code);
+        morton_decode_2d_u32((u32) code, &x16, &y16);
+        ASSERT(x16 == c16[0] && y16 == c16[1]);
+
+        u32 c10[3] = { c[0] & 0x3FF, c[1] & 0x3FF, c[2] & 0x3FF };
+        code = naive_interleave(c10, 3, 10);
+        ASSERT(morton_encode_3d_u32(c[0], c[1], c[2]) == code);
+        morton_decode_3d_u32((u32) code | 0xC0000000u, &x, &y, &z);
+        ASSERT(x == c10[0] && y == c10[1] && z == c10[2]);
+    }
+}
+
+static void test_batches(void)
+{
+    static u32 xs[BATCH_SIZE], ys[BATCH_SIZE], zs[BATCH_SIZE];
+    static u32 decoded_x[BATCH_SIZE], decoded_y[BATCH_SIZE], decoded_z[BATCH_SIZE];
+    static u64 codes[BATCH_SIZE];
+    for (usize i = 0; i < BATCH_SIZE; ++i)
+    {
+        xs[i] = (u32) test_random();
+        ys[i] = (u32) test_random();
+        zs[i] = (u32) test_random();
+    }
+
+    morton_encode_2d_batch(xs, ys, codes, BATCH_SIZE);
+    morton_decode_2d_batch(codes, decoded_x, decoded_y, BATCH_SIZE);
+    for (usize i = 0; i < BATCH_SIZE; ++i)
+        ASSERT(codes[i] == morton_encode_2d_u64(xs[i], ys[i]) && decoded_x[i] == xs[i] && decoded_y[i] == ys[i]);
+
+    morton_encode_3d_batch(xs, ys, zs, codes, BATCH_SIZE);
+    morton_decode_3d_batch(codes, decoded_x, decoded_y, decoded_z, BATCH_SIZE);
+    for (usize i = 0; i < BATCH_SIZE; ++i)
+    {
+        ASSERT(codes[i] == morton_encode_3d_u64(xs[i], ys[i], zs[i]));
+        ASSERT(decoded_x[i] == (xs[i] & 0x1FFFFF) && decoded_y[i] == (ys[i] & 0x1FFFFF) && decoded_z[i] == (zs[i] & 0x1FFFFF));
+    }
+}
+
+int main(void)
+{
+    test_single_values();
+    test_batches();
+    return 0;
+}
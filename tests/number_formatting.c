@@ -0,0 +1,53 @@
+/* Tests for the NUMBER FORMATTING section against snprintf, on random values
+    of every magnitude and on both sides of every power of ten. */
+#include "test.h"
+
+static void check(const utf8* formatted, usize size, const char* expected, int expected_size)
+{
+    ASSERT(size == (usize) expected_size && memcmp(formatted, expected, size) == 0);
+}
+
+static void check_value(u64 value)
+{
+    utf8 formatted[32];
+    char expected[32];
+    check(formatted, format_u64(formatted, value),
+          expected, snprintf(expected, sizeof(expected), "%llu", (unsigned long long) value));
+    check(formatted, format_i64(formatted, (i64) value),
+          expected, snprintf(expected, sizeof(expected), "%lld", (long long) (i64) value));
+    check(formatted, format_u32(formatted, (u32) value),
+          expected, snprintf(expected, sizeof(expected), "%lu", (unsigned long) (u32) value));
+    check(formatted, format_u64_hex(formatted, value),
+          expected, snprintf(expected, sizeof(expected), "%llx", (unsigned long long) value));
+    check(formatted, format_u32_hex(formatted, (u32) value),
+          expected, snprintf(expected, sizeof(expected), "%lx", (unsigned long) (u32) value));
+
+    u32 digits = 1;
+    for (u64 rest = value; rest >= 10; rest /= 10)
+        digits += 1;
+    ASSERT(count_digits_u64(value) == digits);
+}
+
+int main(void)
+{
+    for (u64 value = 0; value < 1000; ++value)
+        check_value(value);
+    for (u64 power = 10; power <= 10000000000000000000ULL; power *= 10)
+    {
+        check_value(power - 1);
+        check_value(power);
+        check_value(power + 1);
+        if (power > (u64) -1 / 10)
+            break;
+    }
+    check_value((u64) -1);
+    check_value((u64) INT64_MAX);
+    check_value((u64) INT64_MIN);
+    check_value(0xFFFFFFFFu);
+    for (usize round = 0; round < 2000000; ++round)
+        check_value(test_random() >> test_random_below(64));
+
+    utf8 formatted[FORMAT_I64_MAX_SIZE];
+    check(formatted, format_i64(formatted, INT64_MIN), "-9223372036854775808", 20);
+    return 0;
+}
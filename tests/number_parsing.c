@@ -0,0 +1,174 @@
+/* Tests for the NUMBER PARSING section against strtod, strtoull and strtoll:
+    the same value to the bit and the same number of bytes consumed, on
+    printed doubles, long digit strings near halfway points and exact
+    midpoints between neighbouring doubles. */
+#include "test.h"
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+
+static void check_f64(const char* text)
+{
+    f64         value    = 0;
+    ParseResult result   = parse_f64(string_from_cstring(text), &value);
+    char*       end      = 0;
+    f64         expected = strtod(text, &end);
+    usize       consumed = (usize) (end - text);
+    ASSERTF(result.consumed == consumed, "'%s' consumed %zu, not %zu.", text, result.consumed, consumed);
+    ASSERTF((result.error == PARSE_NO_DIGITS) == (consumed == 0), "'%s' has digits.", text);
+    if (result.error == PARSE_NO_DIGITS)
+        return;
+    ASSERTF(memcmp(&value, &expected, sizeof(value)) == 0 || (isnan(value) && isnan(expected)),
+            "'%s' is %.17g, not %.17g.", text, value, expected);
+    bool overflowed = isinf(expected) && !strpbrk(text, "iI");
+    ASSERTF((result.error == PARSE_OVERFLOW) == overflowed, "'%s' overflow.", text);
+}
+
+static void check_integer(const char* text)
+{
+    char* end = 0;
+    if (text[0] != '-' && text[0] != '+')
+    {
+        u64                value    = 0;
+        ParseResult        result   = parse_u64(string_from_cstring(text), &value);
+        unsigned long long expected = (errno = 0, strtoull(text, &end, 10));
+        ASSERTF(result.consumed == (usize) (end - text), "'%s'", text);
+        ASSERTF((errno == ERANGE) == (result.error == PARSE_OVERFLOW), "'%s'", text);
+        ASSERTF(result.error == PARSE_OVERFLOW || value == expected, "'%s'", text);
+    }
+    i64         value    = 0;
+    ParseResult result   = parse_i64(string_from_cstring(text), &value);
+    long long   expected = (errno = 0, strtoll(text, &end, 10));
+    ASSERTF(result.consumed == (usize) (end - text), "'%s'", text);
+    ASSERTF((errno == ERANGE) == (result.error == PARSE_OVERFLOW), "'%s'", text);
+    ASSERTF(result.error == PARSE_OVERFLOW || value == expected, "'%s'", text);
+}
+
+static f64 random_f64(void)
+{
+    u64 bits = test_random();
+    f64 value;
+    memcpy(&value, &bits, sizeof(value));
+    return isnan(value) ? 0.0 : value;
+}
+
+static void test_fixed(void)
+{
+    const char* texts[] = {
+        "0", "-0", "1", "1.5", "1e5", "1e", "1e+", "1.e3", ".5", ".", "-.e1", "+3",
+        "inf", "-Infinity", "infin", "nan", "NaN(",
+        "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623159e308", "1e400", "1e-400",
+        "9007199254740993", "9007199254740992.5", "1e23", "8.988465674311580536566680e307",
+        "2.2250738585072011e-308", "2.2250738585072012e-308",
+        "0.000000000000000000000000000000001234567890123456789012345",
+        "123456789012345678901234567890", "00000000000000000000000000000001.5",
+        "7.4109846876186981626485318930233205854758970274076e-323",
+        "1e99999999999", "1e-99999999999",
+    };
+    for (usize i = 0; i < ARRAY_COUNT(texts); ++i)
+        check_f64(texts[i]);
+
+    u64         u = 0;
+    i64         i = 0;
+    ParseResult result = parse_u64(STR("18446744073709551615"), &u);
+    ASSERT(result.error == PARSE_OK && u == UINT64_MAX);
+    ASSERT(parse_u64(STR("18446744073709551616"), &u).error == PARSE_OVERFLOW);
+    ASSERT(parse_u64(STR("99999999999999999999"), &u).error == PARSE_OVERFLOW);
+    result = parse_i64(STR("-9223372036854775808"), &i);
+    ASSERT(result.error == PARSE_OK && i == INT64_MIN);
+    result = parse_i64(STR("-"), &i);
+    ASSERT(result.error == PARSE_NO_DIGITS && result.consumed == 0);
+
+    /* Not null terminated: the digits stop at the end of the view. */
+    f64 value = 0;
+    result = parse_f64(string_make("12345", 3), &value);
+    ASSERT(result.consumed == 3 && value == 123.0);
+}
+
+static void test_random_floats(void)
+{
+    char text[900];
+    for (usize round = 0; round < 1000000; ++round)
+    {
+        switch (round % 6)
+        {
+            case 0:
+                snprintf(text, sizeof(text), "%.17g", random_f64());
+                break;
+            case 1:
+                snprintf(text, sizeof(text), "%.*g", (int) test_random_below(25) + 1, random_f64());
+                break;
+            case 2:
+                snprintf(text, sizeof(text), "%llu.%llue%d", (unsigned long long) test_random_below(100000),
+                         (unsigned long long) test_random(), (int) test_random_below(700) - 350);
+                break;
+            case 3:
+            {
+                /* Long digit strings, often ending in 5 and zeros: near halfway. */
+                usize length = 0;
+                usize digits = test_random_below(40) + 15;
+                for (usize k = 0; k < digits; ++k)
+                    text[length++] = (char) ('0' + test_random_below(10));
+                if (test_random() & 1)
+                {
+                    text[length++] = '5';
+                    for (usize zeros = test_random_below(30); zeros; --zeros)
+                        text[length++] = '0';
+                }
+                snprintf(text + length, sizeof(text) - length, "e%d", (int) test_random_below(600) - 320);
+                break;
+            }
+            case 4:
+            {
+                /* Hundreds of mostly zero digits around the subnormal range. */
+                usize length = 0;
+                usize digits = test_random_below(800) + 1;
+                text[length++] = (char) ('1' + test_random_below(9));
+                for (usize k = 0; k < digits; ++k)
+                    text[length++] = (test_random() & 3) ? '0' : (char) ('0' + test_random_below(10));
+                snprintf(text + length, sizeof(text) - length, "e%d", (int) test_random_below(40) - 330 - (int) digits / 2);
+                break;
+            }
+            default:
+            {
+                /* Exactly halfway between two neighbouring doubles. */
+                f64 value = random_f64();
+                snprintf(text, sizeof(text), "%.40g", value / 2 + nextafter(value, HUGE_VAL) / 2);
+                break;
+            }
+        }
+        check_f64(text);
+    }
+}
+
+static void test_random_integers(void)
+{
+    char text[64];
+    for (usize round = 0; round < 1000000; ++round)
+    {
+        if (round % 3 == 0)
+        {
+            snprintf(text, sizeof(text), "%llu", (unsigned long long) (test_random() >> test_random_below(64)));
+        }
+        else
+        {
+            usize length = 0;
+            if (round & 1)
+                text[length++] = (test_random() & 1) ? '-' : '+';
+            for (usize digits = test_random_below(24) + 1; digits; --digits)
+                text[length++] = (char) ('0' + test_random_below(10));
+            text[length++] = 'x';
+            text[length]   = '\0';
+        }
+        check_integer(text);
+    }
+}
+
+int main(void)
+{
+    test_fixed();
+    test_random_floats();
+    test_random_integers();
+    return 0;
+}
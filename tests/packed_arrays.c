@@ -0,0 +1,90 @@
+/* Tests for the PACKED ARRAYS section at every width: get, set, pack and
+    unpack against a plain array, over counts that end mid-block and ranges
+    that start mid-block, and the words themselves against SIMD-BP128's layout
+    written out one bit at a time. */
+#include "test.h"
+
+#define MAX_VALUES 5000
+
+static u32 values[MAX_VALUES];
+static u32 unpacked[MAX_VALUES];
+
+/* Each block's lane packs values 4j + lane end to end, low bits first, into
+    the lane's words, which are every fourth one. */
+static void naive_pack(const u32* input, usize count, u32 bits, u32* words)
+{
+    memset(words, 0, packed_array_word_count(count, bits) * sizeof(u32));
+    for (usize i = 0; i < count; ++i)
+    {
+        usize block = i / PACKED_ARRAY_BLOCK_SIZE;
+        usize lane  = i & 3;
+        usize first = (i % PACKED_ARRAY_BLOCK_SIZE >> 2) * bits;
+        for (u32 b = 0; b < bits; ++b)
+        {
+            usize bit = first + b;
+            words[(block * bits + (bit >> 5)) * 4 + lane] |= ((input[i] >> b) & 1) << (bit & 31);
+        }
+    }
+}
+
+static void test_random_arrays(void)
+{
+    static u32 layout[MAX_VALUES * 2];
+    for (usize iteration = 0; iteration < 2000; ++iteration)
+    {
+        u32   bits  = 1 + (u32) (iteration & 31);
+        u32   mask  = ~0u >> (32 - bits);
+        usize count = test_random_below(MAX_VALUES);
+        PackedArray array = packed_array_make(count, bits);
+        ASSERT(array.words && array.count == count && array.bits == bits);
+        for (usize i = 0; i < count; ++i)
+        {
+            ASSERT(packed_array_get(&array, i) == 0);
+            values[i] = (u32) test_random();
+        }
+
+        if (iteration & 1)
+        {
+            for (usize i = 0; i < count; ++i)
+                packed_array_set(&array, i, values[i]);
+        }
+        else
+        {
+            usize split = test_random_below(count + 1);
+            packed_array_pack(&array, 0, values, split);
+            packed_array_pack(&array, split, values + split, count - split);
+        }
+        for (usize i = 0; i < count; ++i)
+            ASSERT(packed_array_get(&array, i) == (values[i] & mask));
+
+        naive_pack(values, count, bits, layout);
+        ASSERT(memcmp(array.words, layout, packed_array_word_count(count, bits) * sizeof(u32)) == 0);
+
+        /* Overwrites leave the neighbours alone. */
+        for (usize k = 0; count && k < 200; ++k)
+        {
+            usize i = test_random_below(count);
+            values[i] = (u32) test_random();
+            packed_array_set(&array, i, values[i]);
+        }
+        usize start = test_random_below(count + 1);
+        usize taken = test_random_below(count - start + 1);
+        packed_array_unpack(&array, start, unpacked, taken);
+        for (usize i = 0; i < taken; ++i)
+            ASSERT(unpacked[i] == (values[start + i] & mask));
+        for (usize i = 0; i < count; ++i)
+            ASSERT(packed_array_get(&array, i) == (values[i] & mask));
+
+        packed_array_free(&array);
+        ASSERT(!array.words && !array.count);
+    }
+}
+
+int main(void)
+{
+    ASSERT(packed_array_bits_needed(150) == 8 && packed_array_bits_needed(255) == 8 && packed_array_bits_needed(256) == 9);
+    ASSERT(packed_array_bits_needed(0) == 1 && packed_array_bits_needed(1) == 1 && packed_array_bits_needed(~0u) == 32);
+    ASSERT(packed_array_word_count(0, 7) == 0 && packed_array_word_count(1, 7) == 28 && packed_array_word_count(129, 7) == 56);
+    test_random_arrays();
+    return 0;
+}
@@ -0,0 +1,108 @@
+/* Tests for the RANK AND SELECT section against a running count: every rank
+    and every select on bitmaps from empty to full, and on large clustered
+    bitmaps where sparse gaps between dense runs make samples listed. */
+#include "test.h"
+
+static void test_select_in_word(void)
+{
+    for (usize iteration = 0; iteration < 100000; ++iteration)
+    {
+        u64 word = test_random() >> test_random_below(64);
+        if (iteration & 1)
+            word &= test_random();
+        u64 rest = word;
+        for (u32 rank = 0; rest; ++rank)
+        {
+            ASSERT(internal_select_in_word(word, rank) == bit_ctz_u64(rest));
+            rest &= rest - 1;
+        }
+    }
+    ASSERT(internal_select_in_word(~0ULL, 63) == 63 && internal_select_in_word(1ULL << 63, 0) == 63);
+}
+
+static bool random_bit(u32 density)
+{
+    switch (density)
+    {
+        case 0:  return test_random_below(1000) == 0;
+        case 1:  return test_random_below(20) == 0;
+        case 2:  return true;
+        case 3:  return false;
+        default: return test_random() & 1;
+    }
+}
+
+static void test_every_query(void)
+{
+    for (usize iteration = 0; iteration < 400; ++iteration)
+    {
+        usize  size    = test_random_below(iteration < 200 ? 3000 : 300000);
+        u32    density = (u32) test_random_below(5);
+        Bitset set     = bitset_make(size);
+        for (usize i = 0; i < size; ++i)
+        {
+            if (random_bit(density))
+                bitset_set(&set, i);
+        }
+
+        RankSelect index = rank_select_make(&set);
+        usize rank = 0;
+        for (usize i = 0; i <= size; ++i)
+        {
+            ASSERT(rank_select_rank(&index, i) == rank);
+            if (i < size && bitset_test(&set, i))
+            {
+                ASSERT(rank_select_select(&index, rank) == i);
+                ++rank;
+            }
+        }
+        ASSERT(index.ones == rank && rank_select_select(&index, rank) == BITSET_NOT_FOUND);
+        rank_select_free(&index);
+        bitset_free(&set);
+    }
+}
+
+/* Dense runs separated by long, nearly empty gaps: the samples that straddle
+    a gap have their set bits listed, the others are binary searched. */
+static void test_clustered(void)
+{
+    for (usize iteration = 0; iteration < 6; ++iteration)
+    {
+        usize  size = 3000000 + test_random_below(100000);
+        Bitset set  = bitset_make(size);
+        for (usize i = 0; i < size;)
+        {
+            usize run   = test_random_below(2000);
+            bool  dense = test_random() & 1;
+            for (usize j = 0; j < run && i < size; ++j, ++i)
+            {
+                if (dense ? (test_random() & 3) != 0 : test_random_below(iteration * 3000 + 1) == 0)
+                    bitset_set(&set, i);
+            }
+            i += test_random_below(iteration * 20000 + 1);
+        }
+
+        RankSelect index = rank_select_make(&set);
+        ASSERT(iteration < 2 || index.positions);
+        usize rank = 0;
+        for (usize i = 0; i < size; ++i)
+        {
+            if (bitset_test(&set, i))
+            {
+                ASSERT(rank_select_select(&index, rank) == i && rank_select_rank(&index, i) == rank);
+                ++rank;
+            }
+        }
+        ASSERT(index.ones == rank);
+        rank_select_free(&index);
+        bitset_free(&set);
+    }
+}
+
+int main(void)
+{
+    test_select_in_word();
+    test_every_query();
+    test_clustered();
+    return 0;
+}
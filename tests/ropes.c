@@ -0,0 +1,163 @@
+/* Tests for the ROPES section: random inserts, deletes and slices checked
+    against a flat buffer, the AVL invariants and cached counts after every
+    batch, snapshots, and edits that run out of arena. */
+#include "test.h"
+
+static char  model[1 << 22];
+static usize model_size;
+
+/* Checks every cached count and the balance. Returns the height. */
+static u32 check_node(const RopeNode* node)
+{
+    if (!node->left)
+    {
+        usize lines, runes;
+        internal_rope_count(node->data, node->size, &lines, &runes);
+        ASSERT(node->size > 0 && node->height == 0 && node->lines == lines && node->runes == runes);
+        return 0;
+    }
+    u32 left  = check_node(node->left);
+    u32 right = check_node(node->right);
+    ASSERT(left <= right + 1 && right <= left + 1);
+    ASSERT(node->height == 1 + (left > right ? left : right));
+    ASSERT(node->size  == node->left->size  + node->right->size);
+    ASSERT(node->lines == node->left->lines + node->right->lines);
+    ASSERT(node->runes == node->left->runes + node->right->runes);
+    return node->height;
+}
+
+static void check_rope(const Rope* rope, Arena* scratch)
+{
+    if (rope->root)
+        check_node(rope->root);
+    String text = rope_to_string(rope, scratch);
+    ASSERT(text.size == model_size && memcmp(text.data, model, model_size) == 0);
+
+    usize lines = 1;
+    usize runes = 0;
+    for (usize i = 0; i < model_size; ++i)
+    {
+        lines += model[i] == '\n';
+        runes += ((u8) model[i] & 0xC0) != 0x80;
+    }
+    ASSERT(rope_line_count(rope) == lines && rope_rune_count(rope) == runes);
+
+    usize line = 0;
+    for (usize i = 0; i < model_size; ++i)
+    {
+        if (i == 0 || model[i - 1] == '\n')
+            ASSERT(rope_offset_of_line(rope, line) == i);
+        ASSERT(rope_line_of_offset(rope, i) == line);
+        line += model[i] == '\n';
+    }
+    ASSERT(rope_offset_of_line(rope, lines) == STRING_NOT_FOUND);
+
+    /* The iterator yields the same text, chunk by chunk. */
+    RopeIterator iterator = rope_iterator_make(rope);
+    String       chunk;
+    usize        at = 0;
+    while (rope_iterator_next(&iterator, &chunk))
+    {
+        ASSERT(chunk.size && at + chunk.size <= model_size && memcmp(chunk.data, model + at, chunk.size) == 0);
+        at += chunk.size;
+    }
+    ASSERT(at == model_size);
+    arena_reset(scratch);
+}
+
+static void random_range(usize* start, usize* end)
+{
+    usize a = test_random_below(model_size + 1);
+    usize b = test_random_below(model_size + 1);
+    *start = a < b ? a : b;
+    *end   = a < b ? b : a;
+}
+
+static void test_random_edits(Rope* rope, Arena* scratch)
+{
+    const char* alphabet = "ab\n\xC3\xA9\xE2\x82\xAC";  /* With a 2 and a 3-byte rune. */
+    char        text[5000];
+    for (usize round = 0; round < 20000; ++round)
+    {
+        usize action = test_random_below(10);
+        if (action < 6)
+        {
+            usize size   = test_random_below(4) == 0 ? test_random_below(3000) + 1 : test_random_below(5) + 1;
+            usize offset = test_random_below(model_size + 1);
+            for (usize i = 0; i < size; ++i)
+                text[i] = alphabet[test_random_below(8)];
+            ASSERT(rope_insert(rope, offset, string_make(text, size)));
+            memmove(model + offset + size, model + offset, model_size - offset);
+            memcpy(model + offset, text, size);
+            model_size += size;
+        }
+        else if (action < 9)
+        {
+            usize start, end;
+            random_range(&start, &end);
+            if (test_random_below(3))
+                end = start + (end - start) % 50;
+            ASSERT(rope_delete(rope, start, end));
+            memmove(model + start, model + end, model_size - end);
+            model_size -= end - start;
+        }
+        else
+        {
+            usize start, end;
+            random_range(&start, &end);
+            Rope slice = rope_make(scratch);
+            ASSERT(rope_slice(rope, start, end, &slice));
+            String text_slice = rope_to_string(&slice, scratch);
+            ASSERT(text_slice.size == end - start && memcmp(text_slice.data, model + start, end - start) == 0);
+            ASSERT(start == end || rope_byte_at(rope, start) == model[start]);
+            arena_reset(scratch);
+        }
+        if (round % 500 == 0)
+            check_rope(rope, scratch);
+    }
+    check_rope(rope, scratch);
+}
+
+static void test_snapshots(Rope* rope)
+{
+    Rope  snapshot = *rope;
+    usize size     = model_size;
+    ASSERT(rope_delete(rope, 0, 10));
+    ASSERT(rope_size(&snapshot) == size);
+    ASSERT(rope_concat(rope, snapshot));
+    ASSERT(rope_size(rope) == size * 2 - 10);
+    check_node(rope->root);
+}
+
+static void test_out_of_memory(void)
+{
+    Arena tiny      = arena_make(KILOBYTES(64), MEMORY_PAGES_NORMAL);
+    Rope  rope      = rope_make(&tiny);
+    bool  exhausted = false;
+    for (usize i = 0; i < 100000 && !exhausted; ++i)
+    {
+        usize size = rope_size(&rope);
+        usize used = tiny.used;
+        if (!rope_insert(&rope, test_random_below(size + 1), STR("hello world\n")))
+        {
+            ASSERT(rope_size(&rope) == size && tiny.used == used);
+            exhausted = true;
+        }
+    }
+    ASSERT(exhausted);
+    check_node(rope.root);
+    arena_free(&tiny);
+}
+
+int main(void)
+{
+    Arena arena   = arena_make(GIGABYTES(1), MEMORY_PAGES_NORMAL);
+    Arena scratch = arena_make(GIGABYTES(1), MEMORY_PAGES_NORMAL);
+    Rope  rope    = rope_make(&arena);
+    test_random_edits(&rope, &scratch);
+    test_snapshots(&rope);
+    test_out_of_memory();
+    arena_free(&arena);
+    arena_free(&scratch);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/* Tests for the SMALL STRINGS section: the inline/heap boundary, appending
+    a string to itself, and random edits checked against a plain buffer. */
+#include "test.h"
+
+STATIC_ASSERT(sizeof(SmallString) == 3 * sizeof(void*));
+
+static bool has_contents(const SmallString* string, const char* expected)
+{
+    return small_string_size(string) == strlen(expected) && strcmp(small_string_cstring(string), expected) == 0;
+}
+
+static void test_boundary(void)
+{
+    SmallString a = small_string_make(STR("hello"));
+    SmallString b = small_string_make(STR("hello"));
+    ASSERT(small_string_is_inline(&a) && has_contents(&a, "hello"));
+    ASSERT(small_string_equals(&a, &b));
+
+    /* Exactly full inline, then one byte over. */
+    char full[SMALL_STRING_INLINE_CAPACITY + 2];
+    memset(full, 'x', sizeof(full));
+    full[SMALL_STRING_INLINE_CAPACITY] = '\0';
+    small_string_assign(&a, string_from_cstring(full));
+    ASSERT(small_string_is_inline(&a) && has_contents(&a, full));
+    small_string_append(&a, STR("y"));
+    full[SMALL_STRING_INLINE_CAPACITY]     = 'y';
+    full[SMALL_STRING_INLINE_CAPACITY + 1] = '\0';
+    ASSERT(!small_string_is_inline(&a) && has_contents(&a, full));
+
+    /* Appending a string to itself, across the spill and on the heap. */
+    small_string_assign(&b, STR("abcdefghijkl"));
+    small_string_append(&b, small_string_view(&b));
+    ASSERT(has_contents(&b, "abcdefghijklabcdefghijkl"));
+    for (int i = 0; i < 1000; ++i)
+        small_string_append(&b, string_slice(small_string_view(&b), 0, 3));
+    ASSERT(small_string_size(&b) == 3024 && small_string_capacity(&b) >= 3024);
+
+    /* Heap and inline strings with the same contents are equal. */
+    small_string_assign(&b, STR("hello"));
+    SmallString c = small_string_make(STR("hello"));
+    ASSERT(!small_string_is_inline(&b) && small_string_is_inline(&c) && small_string_equals(&b, &c));
+
+    /* Clearing an inline string zeroes its old bytes. */
+    small_string_clear(&c);
+    small_string_append(&c, STR("hi"));
+    SmallString d = small_string_make(STR("hi"));
+    ASSERT(small_string_equals(&c, &d));
+
+    SmallString zero;
+    memset(&zero, 0, sizeof(zero));
+    ASSERT(small_string_size(&zero) == 0 && small_string_cstring(&zero)[0] == '\0');
+
+    small_string_free(&a);
+    small_string_free(&b);
+    small_string_free(&c);
+    small_string_free(&d);
+}
+
+static void test_random_edits(void)
+{
+    char        model[512];
+    usize       size = 0;
+    SmallString string;
+    memset(&string, 0, sizeof(string));
+    for (usize round = 0; round < 200000; ++round)
+    {
+        char  piece[40];
+        usize length = test_random_below(sizeof(piece));
+        for (usize k = 0; k < length; ++k)
+            piece[k] = (char) ('a' + test_random_below(26));
+
+        usize action = test_random_below(10);
+        if (action == 0 || size + length >= sizeof(model))
+        {
+            ASSERT(small_string_assign(&string, string_make(piece, length)));
+            memcpy(model, piece, length);
+            size = length;
+        }
+        else if (action == 1)
+        {
+            small_string_clear(&string);
+            size = 0;
+        }
+        else
+        {
+            ASSERT(small_string_append(&string, string_make(piece, length)));
+            memcpy(model + size, piece, length);
+            size += length;
+        }
+        model[size] = '\0';
+        ASSERT(has_contents(&string, model));
+        ASSERT(small_string_is_inline(&string) || small_string_capacity(&string) >= size);
+
+        SmallString copy = small_string_make(small_string_view(&string));
+        ASSERT(small_string_equals(&string, &copy));
+        small_string_free(&copy);
+    }
+    small_string_free(&string);
+}
+
+int main(void)
+{
+    test_boundary();
+    test_random_edits();
+    return 0;
+}
@@ -0,0 +1,89 @@
+/* Tests for the STRINGS section, checked against the C library on random
+    strings over small alphabets, where matches and near-matches are common. */
+#include "test.h"
+
+#define FOR_EACH_FRUIT(F) F(FRUIT_APPLE) F(FRUIT_BANANA)
+typedef enum Fruit { FOR_EACH_FRUIT(GENERATE_ENUM) } Fruit;
+static const String FRUIT_NAMES[] = { FOR_EACH_FRUIT(GENERATE_STRING) };
+
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+static usize naive_find(String haystack, String needle)
+{
+    for (usize i = 0; needle.size <= haystack.size && i <= haystack.size - needle.size; ++i)
+    {
+        if (memcmp(haystack.data + i, needle.data, needle.size) == 0)
+            return i;
+    }
+    return STRING_NOT_FOUND;
+}
+
+static void random_text(char* text, usize size, usize alphabet)
+{
+    for (usize i = 0; i < size; ++i)
+        text[i] = (char) ('a' + test_random_below(alphabet));
+}
+
+static void test_basics(void)
+{
+    ASSERT(string_equals(FRUIT_NAMES[FRUIT_BANANA], STR("FRUIT_BANANA")));
+    ASSERT(STR("").size == 0 && STR("abc").size == 3);
+    ASSERT(string_equals(string_from_cstring("preamble"), STR("preamble")));
+
+    String name = STR("preamble");
+    ASSERT(string_starts_with(name, STR("pre")) && string_starts_with(name, STR("")));
+    ASSERT(string_ends_with(name, STR("amble")) && !string_ends_with(STR("ab"), STR("abc")));
+    ASSERT(string_equals(string_slice(name, 3, 5), STR("am")));
+    ASSERT(string_equals(string_slice(name, 6, 100), STR("le")));
+    ASSERT(string_slice(name, 9, 4).size == 0);
+
+    char line[32];
+    snprintf(line, sizeof(line), "<" STRING_FORMAT ">", STRING_ARGS(string_slice(name, 0, 3)));
+    ASSERT(strcmp(line, "<pre>") == 0);
+}
+
+static void test_random_strings(void)
+{
+    char a[200];
+    char b[200];
+    for (usize round = 0; round < 200000; ++round)
+    {
+        usize size_a = test_random_below(150);
+        usize size_b = test_random_below(150);
+        random_text(a, size_a, 2);
+        random_text(b, size_b, 2);
+        if (test_random() & 1)
+        {
+            /* Equal, or differing in one byte anywhere, even past 32. */
+            size_b = size_a;
+            memcpy(b, a, size_a);
+            if (size_a && (test_random() & 1))
+                b[test_random_below(size_a)] ^= 1;
+        }
+        String x = string_make(a, size_a);
+        String y = string_make(b, size_b);
+
+        int expected = memcmp(a, b, size_a < size_b ? size_a : size_b);
+        if (!expected)
+            expected = (size_a > size_b) - (size_a < size_b);
+        ASSERT(sign(string_compare(x, y)) == sign(expected));
+        ASSERT(string_equals(x, y) == (size_a == size_b && memcmp(a, b, size_a) == 0));
+        String prefix = string_slice(y, 0, 8);
+        ASSERT(string_starts_with(x, prefix) == (prefix.size <= size_a && memcmp(a, prefix.data, prefix.size) == 0));
+
+        const char* byte  = (const char*) memchr(a, 'b', size_a);
+        ASSERT(string_find_byte(x, 'b') == (byte ? (usize) (byte - a) : STRING_NOT_FOUND));
+        String needle = string_slice(y, 0, test_random_below(6));
+        ASSERT(string_find(x, needle) == naive_find(x, needle));
+    }
+}
+
+int main(void)
+{
+    test_basics();
+    test_random_strings();
+    return 0;
+}
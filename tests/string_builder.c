@@ -0,0 +1,78 @@
+/* Tests for the STRING BUILDER section, on the heap and in an arena. */
+#include "test.h"
+
+static void test_appends(Arena* arena)
+{
+    StringBuilder builder = string_builder_make(arena, 4);
+    ASSERT(string_builder_append(&builder, STR("Hello, ")));
+    ASSERT(string_builder_append_rune(&builder, 0x1F44B));
+    ASSERT(string_builder_append_rune(&builder, 0xD800));  /* Becomes U+FFFD. */
+    ASSERT(string_builder_append_byte(&builder, ' '));
+    ASSERT(string_builder_append_i64(&builder, -42));
+    ASSERT(string_builder_append_byte(&builder, ' '));
+    ASSERT(string_builder_append_u64(&builder, 18446744073709551615ULL));
+    ASSERT(string_builder_append_byte(&builder, ' '));
+    ASSERT(string_builder_append_f64(&builder, 0.1));
+    ASSERT(string_builder_append_byte(&builder, ' '));
+    ASSERT(string_builder_append_f32(&builder, 1.5f));
+    /* ASSERT can't take the format strings, which it would print as one. */
+    bool formatted = true;
+    for (int i = 0; i < 1000; ++i)
+        formatted &= string_builder_appendf(&builder, ",%d", i);
+    formatted &= string_builder_appendf(&builder, "%0300d", 7);
+    ASSERT(formatted);
+
+    String result = string_builder_to_string(&builder);
+    ASSERT(string_starts_with(result, STR("Hello, \xF0\x9F\x91\x8B\xEF\xBF\xBD -42 18446744073709551615 0.1 1.5,0,1,2,")));
+    char expected[400];
+    int  length = snprintf(expected, sizeof(expected), "998,999%0300d", 7);
+    ASSERT(string_ends_with(result, string_make(expected, (usize) length)));
+
+    if (arena)
+    {
+        /* The unused capacity went back to the arena. */
+        ASSERT(arena->base + arena->used == (const u8*) result.data + result.size);
+    }
+    else
+    {
+        string_builder_free(&builder);
+        ASSERT(!builder.data && !builder.size);
+    }
+}
+
+static void test_arena_growth(Arena* arena)
+{
+    /* Once something else is pushed, growing has to move the buffer. */
+    StringBuilder builder = string_builder_make(arena, 2);
+    arena_push(arena, 10, 1);
+    ASSERT(string_builder_append(&builder, STR("abcdef")));
+    ASSERT(string_equals(string_builder_to_string(&builder), STR("abcdef")));
+
+    string_builder_clear(&builder);
+    ASSERT(string_builder_to_string(&builder).size == 0);
+    ASSERT(string_builder_append(&builder, STR("xyz")));
+    ASSERT(string_equals(string_builder_to_string(&builder), STR("xyz")));
+
+    /* Running out of arena leaves the builder as it was. */
+    Arena small = arena_make(KILOBYTES(64), MEMORY_PAGES_NORMAL);
+    StringBuilder full = string_builder_make(&small, 16);
+    ASSERT(string_builder_append(&full, STR("kept")));
+    char big[KILOBYTES(8)];
+    memset(big, 'z', sizeof(big));
+    usize appended = 0;
+    while (string_builder_append(&full, string_make(big, sizeof(big))))
+        appended += 1;
+    ASSERT(appended >= 4 && full.size == 4 + appended * sizeof(big));
+    ASSERT(string_starts_with(string_builder_to_string(&full), STR("keptzzz")));
+    arena_free(&small);
+}
+
+int main(void)
+{
+    Arena arena = arena_make(MEGABYTES(64), MEMORY_PAGES_NORMAL);
+    test_appends(0);
+    test_appends(&arena);
+    test_arena_growth(&arena);
+    arena_free(&arena);
+    return 0;
+}
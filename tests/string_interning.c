@@ -0,0 +1,78 @@
+/* Tests for the STRING INTERNING section. The concurrent interner is hit
+    from four threads interning the same names in different orders. */
+#include "test.h"
+#include <pthread.h>
+
+#define THREAD_COUNT 4
+#define NAME_COUNT   20000
+
+static ConcurrentInterner shared;
+static u32 thread_ids[THREAD_COUNT][NAME_COUNT];
+
+static String name_of(char* buffer, usize size, const char* prefix, int i)
+{
+    int length = snprintf(buffer, size, "%s%d", prefix, i);
+    return string_make(buffer, (usize) length);
+}
+
+static void test_interner(void)
+{
+    Interner interner = interner_make(MEGABYTES(256));
+    char     buffer[32];
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int i = 0; i < 100000; ++i)
+            ASSERT(interner_intern(&interner, name_of(buffer, sizeof(buffer), "id_", i)) == (u32) i);
+    }
+    ASSERT(interner.count == 100000);
+
+    String name = interner_string(&interner, 777);
+    ASSERT(string_equals(name, STR("id_777")) && name.data[name.size] == '\0');
+    ASSERT(interner_find(&interner, STR("nope")) == INTERNER_INVALID_ID);
+    ASSERT(interner_find(&interner, STR("id_5")) == 5);
+    ASSERT(interner_canonical(&interner, STR("id_9")).data == interner_string(&interner, 9).data);
+    ASSERT(interner_intern(&interner, STR("")) == 100000);
+    ASSERT(interner_string(&interner, 100000).size == 0);
+    interner_free(&interner);
+}
+
+static void* intern_names(void* argument)
+{
+    int  thread = (int) (intptr_t) argument;
+    char buffer[32];
+    for (int i = 0; i < NAME_COUNT; ++i)
+    {
+        int name = (i * 7 + thread * 13) % NAME_COUNT;
+        thread_ids[thread][name] = concurrent_interner_intern(&shared, name_of(buffer, sizeof(buffer), "name", name));
+    }
+    return 0;
+}
+
+static void test_concurrent_interner(void)
+{
+    concurrent_interner_init(&shared, MEGABYTES(64));
+    pthread_t threads[THREAD_COUNT];
+    for (int t = 0; t < THREAD_COUNT; ++t)
+        ASSERT(pthread_create(&threads[t], 0, intern_names, (void*) (intptr_t) t) == 0);
+    for (int t = 0; t < THREAD_COUNT; ++t)
+        pthread_join(threads[t], 0);
+
+    char buffer[32];
+    for (int i = 0; i < NAME_COUNT; ++i)
+    {
+        String name = name_of(buffer, sizeof(buffer), "name", i);
+        for (int t = 1; t < THREAD_COUNT; ++t)
+            ASSERT(thread_ids[t][i] == thread_ids[0][i]);
+        ASSERT(string_equals(concurrent_interner_string(&shared, thread_ids[0][i]), name));
+        ASSERT(concurrent_interner_find(&shared, name) == thread_ids[0][i]);
+    }
+    ASSERT(concurrent_interner_find(&shared, STR("name-1")) == INTERNER_INVALID_ID);
+    concurrent_interner_free(&shared);
+}
+
+int main(void)
+{
+    test_interner();
+    test_concurrent_interner();
+    return 0;
+}
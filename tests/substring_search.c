@@ -0,0 +1,119 @@
+/* Tests for the SUBSTRING SEARCH section against naive loops, over small
+    alphabets where partial matches are everywhere, planted matches, and the
+    repetitive inputs that push the filter over to Two-Way. */
+#include "test.h"
+
+static u8 haystack[3000];
+static u8 needle[300];
+
+static usize naive_find(usize n, usize m, usize start)
+{
+    for (usize i = start; m <= n && i <= n - m; ++i)
+    {
+        if (memcmp(haystack + i, needle, m) == 0)
+            return i;
+    }
+    return STRING_NOT_FOUND;
+}
+
+/* Last match ending at least `end_gap` bytes before the end. */
+static usize naive_rfind(usize n, usize m, usize end_gap)
+{
+    for (usize i = n - m + 1; m <= n && i-- > 0;)
+    {
+        if (n - m - i >= end_gap && memcmp(haystack + i, needle, m) == 0)
+            return i;
+    }
+    return STRING_NOT_FOUND;
+}
+
+static usize naive_count(usize n, usize m)
+{
+    usize count = 0;
+    for (usize i = 0; m <= n && i <= n - m;)
+    {
+        if (memcmp(haystack + i, needle, m) == 0)
+        {
+            ++count;
+            i += m;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return count;
+}
+
+static void random_text(u8* text, usize size, u32 alphabet)
+{
+    for (usize i = 0; i < size; ++i)
+        text[i] = (u8) ('a' + test_random_below(alphabet));
+}
+
+static void test_examples(void)
+{
+    ASSERT(string_find(STR("hello"), STR("")) == 0 && string_rfind(STR("hello"), STR("")) == 5);
+    ASSERT(string_find(STR("abc"), STR("abcd")) == STRING_NOT_FOUND && string_rfind(STR(""), STR("a")) == STRING_NOT_FOUND);
+    ASSERT(string_find(STR("abcabc"), STR("bc")) == 1 && string_rfind(STR("abcabc"), STR("bc")) == 4);
+    ASSERT(string_count(STR("aaaa"), STR("aa")) == 2 && string_count(STR("abc"), STR("")) == 4);
+}
+
+static void test_random_strings(void)
+{
+    for (usize iteration = 0; iteration < 400000; ++iteration)
+    {
+        usize n = test_random_below(iteration % 10 == 0 ? 3000 : 200);
+        usize m = test_random_below(iteration % 7 == 0 ? 300 : 12);
+        u32   alphabet = 1 + (u32) test_random_below(iteration % 3 == 0 ? 2 : iteration % 3 == 1 ? 4 : 256);
+        random_text(haystack, n, alphabet);
+        random_text(needle, m, alphabet);
+        if (n > m && (test_random() & 1))
+            memcpy(haystack + test_random_below(n - m + 1), needle, m);
+        if (iteration % 5 == 0)
+        {
+            /* A run of one byte with a near miss in the needle: every
+                position matches for a while, so the verification budget runs
+                out and Two-Way takes over. */
+            memset(haystack, 'a', n);
+            memset(needle, 'a', m);
+            if (m)
+                needle[test_random_below(m)] = 'b';
+        }
+
+        String h = string_make((const utf8*) haystack, n);
+        String x = string_make((const utf8*) needle, m);
+        ASSERT(string_find(h, x) == naive_find(n, m, 0));
+        ASSERT(string_rfind(h, x) == (m ? naive_rfind(n, m, 0) : n));
+        ASSERT(string_count(h, x) == (m ? naive_count(n, m) : n + 1));
+    }
+}
+
+/* Two-Way on its own, from every kind of starting point. */
+static void test_two_way(void)
+{
+    for (usize iteration = 0; iteration < 100000; ++iteration)
+    {
+        usize n = test_random_below(100);
+        usize m = 1 + test_random_below(10);
+        u32   alphabet = 1 + (u32) test_random_below(3);
+        random_text(haystack, n, alphabet);
+        random_text(needle, m, alphabet);
+        if (m > n)
+            continue;
+
+        String h = string_make((const utf8*) haystack, n);
+        String x = string_make((const utf8*) needle, m);
+        usize start = test_random_below(n - m + 2);
+        ASSERT(internal_two_way(h, x, start, false) == naive_find(n, m, start));
+        ASSERT(internal_two_way(h, x, start, true) == naive_rfind(n, m, start));
+    }
+}
+
+int main(void)
+{
+    test_examples();
+    test_random_strings();
+    test_two_way();
+    return 0;
+}
@@ -0,0 +1,25 @@
+/* Helpers shared by the tests. Every test is a program that returns 0 or
+    stops at the first failed ASSERT. */
+#ifndef TEST_H
+#define TEST_H
+
+#include "preamble.h"
+
+/* xorshift64, seeded the same every run so failures reproduce. */
+static u64 test_random_state = 0x9E3779B97F4A7C15ULL;
+
+static inline u64 test_random(void)
+{
+    test_random_state ^= test_random_state << 13;
+    test_random_state ^= test_random_state >> 7;
+    test_random_state ^= test_random_state << 17;
+    return test_random_state;
+}
+
+/* Uniform enough in [0, bound) for bounds far below 2^64. */
+static inline usize test_random_below(usize bound)
+{
+    return (usize) (test_random() % bound);
+}
+
+#endif
@@ -0,0 +1,145 @@
+/* Tests for utf8_is_valid against a strict one-rune-at-a-time reference, on
+    random text with corrupted bytes and on every 1 to 3-byte sequence (and the
+    interesting 4-byte ones) at several offsets around a 64-byte block edge. */
+#include "test.h"
+
+static bool reference_is_valid(const u8* bytes, usize size)
+{
+    usize i = 0;
+    while (i < size)
+    {
+        u32   r = bytes[i];
+        usize length;
+        u32   smallest;
+        if (r < 0x80)
+        {
+            i += 1;
+            continue;
+        }
+        else if ((r & 0xE0) == 0xC0) { length = 2; r &= 0x1F; smallest = 0x80; }
+        else if ((r & 0xF0) == 0xE0) { length = 3; r &= 0x0F; smallest = 0x800; }
+        else if ((r & 0xF8) == 0xF0) { length = 4; r &= 0x07; smallest = 0x10000; }
+        else return false;
+
+        if (i + length > size)
+            return false;
+        for (usize k = 1; k < length; ++k)
+        {
+            if ((bytes[i + k] & 0xC0) != 0x80)
+                return false;
+            r = (r << 6) | (bytes[i + k] & 0x3F);
+        }
+        if (r < smallest || r > 0x10FFFF || (r >= 0xD800 && r <= 0xDFFF))
+            return false;
+        i += length;
+    }
+    return true;
+}
+
+static usize encode(u32 r, u8* out)
+{
+    if (r < 0x80)
+    {
+        out[0] = (u8) r;
+        return 1;
+    }
+    if (r < 0x800)
+    {
+        out[0] = (u8) (0xC0 | (r >> 6));
+        out[1] = (u8) (0x80 | (r & 0x3F));
+        return 2;
+    }
+    if (r < 0x10000)
+    {
+        out[0] = (u8) (0xE0 | (r >> 12));
+        out[1] = (u8) (0x80 | ((r >> 6) & 0x3F));
+        out[2] = (u8) (0x80 | (r & 0x3F));
+        return 3;
+    }
+    out[0] = (u8) (0xF0 | (r >> 18));
+    out[1] = (u8) (0x80 | ((r >> 12) & 0x3F));
+    out[2] = (u8) (0x80 | ((r >> 6) & 0x3F));
+    out[3] = (u8) (0x80 | (r & 0x3F));
+    return 4;
+}
+
+static u32 random_rune(bool ascii_only)
+{
+    usize kind = ascii_only ? 0 : test_random_below(10);
+    if (kind < 5)
+        return (u32) test_random_below(0x80);
+    if (kind < 7)
+        return (u32) (0x80 + test_random_below(0x780));
+    if (kind < 9)
+    {
+        u32 r = (u32) (0x800 + test_random_below(0xF800));
+        return (r >= 0xD800 && r <= 0xDFFF) ? 0xE000 : r;
+    }
+    return (u32) (0x10000 + test_random_below(0x100000));
+}
+
+static void test_random_text(void)
+{
+    static u8 text[600];
+    usize invalid = 0;
+    for (usize round = 0; round < 300000; ++round)
+    {
+        usize size   = 0;
+        usize target = test_random_below(300);
+        bool  ascii  = test_random_below(4) == 0;
+        while (size < target)
+            size += encode(random_rune(ascii), text + size);
+
+        usize corruptions = test_random_below(3);
+        for (usize k = 0; k < corruptions && size; ++k)
+            text[test_random_below(size)] = (u8) test_random();
+        if (test_random_below(5) == 0)
+            size -= test_random_below(size < 3 ? size + 1 : 3);
+
+        bool expected = reference_is_valid(text, size);
+        invalid += !expected;
+        ASSERT(utf8_is_valid((const utf8*) text, size) == expected);
+    }
+    ASSERT(invalid > 10000);
+}
+
+static void test_every_short_sequence(void)
+{
+    u8 text[140];
+    for (u32 a = 0; a < 256; ++a)
+    for (u32 b = 0; b < 256; ++b)
+    for (u32 c = 0; c < 256; ++c)
+    {
+        memset(text, 'x', sizeof(text));
+        usize at = 62 + (a + b + c) % 5;
+        text[at]     = (u8) a;
+        text[at + 1] = (u8) b;
+        text[at + 2] = (u8) c;
+        ASSERT(utf8_is_valid((const utf8*) text, sizeof(text)) == reference_is_valid(text, sizeof(text)));
+    }
+
+    /* 4-byte leads, with the following bytes at and around the continuation range. */
+    for (u32 a = 0xF0; a < 256; ++a)
+    for (u32 b = 0x80; b < 0xC0; ++b)
+    for (u32 c = 0x7F; c < 0xC1; ++c)
+    for (u32 d = 0x7F; d < 0xC1; ++d)
+    {
+        memset(text, 'x', sizeof(text));
+        usize at = 61 + (b + c + d) % 5;
+        text[at]     = (u8) a;
+        text[at + 1] = (u8) b;
+        text[at + 2] = (u8) c;
+        text[at + 3] = (u8) d;
+        ASSERT(utf8_is_valid((const utf8*) text, sizeof(text)) == reference_is_valid(text, sizeof(text)));
+    }
+}
+
+int main(void)
+{
+    ASSERT(utf8_is_valid("", 0));
+    ASSERT(utf8_is_valid("\xE2\x82\xAC", 3) && !utf8_is_valid("\xE2\x82", 2));
+    ASSERT(!utf8_is_valid("\xED\xA0\x80", 3) && !utf8_is_valid("\xC0\xAF", 2));
+    test_random_text();
+    test_every_short_sequence();
+    return 0;
+}
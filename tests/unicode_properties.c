@@ -0,0 +1,122 @@
+/* Tests for the UNICODE PROPERTIES section. A digest over every rune's
+    category, width and case mappings pins the generated tables to Unicode
+    14.0.0 as Python's unicodedata reports it (reduced to simple mappings the
+    way scripts/generate_unicode_tables.py does), and known runes from every
+    category check the lookups one by one. Regenerating the tables for a new
+    Unicode version means updating UNICODE_DIGEST. */
+#include "test.h"
+#include <ctype.h>
+
+#define UNICODE_DIGEST 0x34E11B3D62C1F9BEULL
+
+typedef struct KnownRune {
+    rune            r;
+    UnicodeCategory category;
+    UnicodeWidth    width;
+    rune            upper;
+    rune            lower;
+} KnownRune;
+
+static const KnownRune KNOWN_RUNES[] = {
+    { 0x00041, UNICODE_CATEGORY_LU, UNICODE_WIDTH_NARROW, 0x00041, 0x00061 },
+    { 0x00061, UNICODE_CATEGORY_LL, UNICODE_WIDTH_NARROW, 0x00041, 0x00061 },
+    { 0x000B5, UNICODE_CATEGORY_LL, UNICODE_WIDTH_NEUTRAL, 0x0039C, 0x000B5 },
+    { 0x000C0, UNICODE_CATEGORY_LU, UNICODE_WIDTH_NEUTRAL, 0x000C0, 0x000E0 },
+    { 0x000DF, UNICODE_CATEGORY_LL, UNICODE_WIDTH_AMBIGUOUS, 0x000DF, 0x000DF },
+    { 0x000FF, UNICODE_CATEGORY_LL, UNICODE_WIDTH_NEUTRAL, 0x00178, 0x000FF },
+    { 0x00130, UNICODE_CATEGORY_LU, UNICODE_WIDTH_NEUTRAL, 0x00130, 0x00069 },
+    { 0x00131, UNICODE_CATEGORY_LL, UNICODE_WIDTH_AMBIGUOUS, 0x00049, 0x00131 },
+    { 0x0017F, UNICODE_CATEGORY_LL, UNICODE_WIDTH_NEUTRAL, 0x00053, 0x0017F },
+    { 0x001C5, UNICODE_CATEGORY_LT, UNICODE_WIDTH_NEUTRAL, 0x001C4, 0x001C6 },
+    { 0x00345, UNICODE_CATEGORY_MN, UNICODE_WIDTH_AMBIGUOUS, 0x00399, 0x00345 },
+    { 0x003A3, UNICODE_CATEGORY_LU, UNICODE_WIDTH_AMBIGUOUS, 0x003A3, 0x003C3 },
+    { 0x003C2, UNICODE_CATEGORY_LL, UNICODE_WIDTH_NEUTRAL, 0x003A3, 0x003C2 },
+    { 0x00301, UNICODE_CATEGORY_MN, UNICODE_WIDTH_AMBIGUOUS, 0x00301, 0x00301 },
+    { 0x00488, UNICODE_CATEGORY_ME, UNICODE_WIDTH_NEUTRAL, 0x00488, 0x00488 },
+    { 0x005D0, UNICODE_CATEGORY_LO, UNICODE_WIDTH_NEUTRAL, 0x005D0, 0x005D0 },
+    { 0x00660, UNICODE_CATEGORY_ND, UNICODE_WIDTH_NEUTRAL, 0x00660, 0x00660 },
+    { 0x00903, UNICODE_CATEGORY_MC, UNICODE_WIDTH_NEUTRAL, 0x00903, 0x00903 },
+    { 0x01E9E, UNICODE_CATEGORY_LU, UNICODE_WIDTH_NEUTRAL, 0x01E9E, 0x000DF },
+    { 0x02028, UNICODE_CATEGORY_ZL, UNICODE_WIDTH_NEUTRAL, 0x02028, 0x02028 },
+    { 0x02029, UNICODE_CATEGORY_ZP, UNICODE_WIDTH_NEUTRAL, 0x02029, 0x02029 },
+    { 0x0200B, UNICODE_CATEGORY_CF, UNICODE_WIDTH_NEUTRAL, 0x0200B, 0x0200B },
+    { 0x02160, UNICODE_CATEGORY_NL, UNICODE_WIDTH_AMBIGUOUS, 0x02160, 0x02170 },
+    { 0x02170, UNICODE_CATEGORY_NL, UNICODE_WIDTH_AMBIGUOUS, 0x02160, 0x02170 },
+    { 0x024B6, UNICODE_CATEGORY_SO, UNICODE_WIDTH_AMBIGUOUS, 0x024B6, 0x024D0 },
+    { 0x03000, UNICODE_CATEGORY_ZS, UNICODE_WIDTH_FULLWIDTH, 0x03000, 0x03000 },
+    { 0x03042, UNICODE_CATEGORY_LO, UNICODE_WIDTH_WIDE, 0x03042, 0x03042 },
+    { 0x04E00, UNICODE_CATEGORY_LO, UNICODE_WIDTH_WIDE, 0x04E00, 0x04E00 },
+    { 0x0AC00, UNICODE_CATEGORY_LO, UNICODE_WIDTH_WIDE, 0x0AC00, 0x0AC00 },
+    { 0x0D800, UNICODE_CATEGORY_CS, UNICODE_WIDTH_NEUTRAL, 0x0D800, 0x0D800 },
+    { 0x0E000, UNICODE_CATEGORY_CO, UNICODE_WIDTH_AMBIGUOUS, 0x0E000, 0x0E000 },
+    { 0x0FF21, UNICODE_CATEGORY_LU, UNICODE_WIDTH_FULLWIDTH, 0x0FF21, 0x0FF41 },
+    { 0x0FF41, UNICODE_CATEGORY_LL, UNICODE_WIDTH_FULLWIDTH, 0x0FF21, 0x0FF41 },
+    { 0x0FFFD, UNICODE_CATEGORY_SO, UNICODE_WIDTH_AMBIGUOUS, 0x0FFFD, 0x0FFFD },
+    { 0x10400, UNICODE_CATEGORY_LU, UNICODE_WIDTH_NEUTRAL, 0x10400, 0x10428 },
+    { 0x1F600, UNICODE_CATEGORY_SO, UNICODE_WIDTH_WIDE, 0x1F600, 0x1F600 },
+    { 0x20000, UNICODE_CATEGORY_LO, UNICODE_WIDTH_WIDE, 0x20000, 0x20000 },
+    { 0xE0001, UNICODE_CATEGORY_CF, UNICODE_WIDTH_NEUTRAL, 0xE0001, 0xE0001 },
+    { 0x10FFFF, UNICODE_CATEGORY_CN, UNICODE_WIDTH_NEUTRAL, 0x10FFFF, 0x10FFFF },
+    { 0x16EA0, UNICODE_CATEGORY_CN, UNICODE_WIDTH_NEUTRAL, 0x16EA0, 0x16EA0 },
+};
+
+static void test_digest(void)
+{
+    u64 digest = 0xCBF29CE484222325ULL;
+    for (rune r = 0; r <= UNICODE_MAX_RUNE; ++r)
+    {
+        u64 values[3] = { (u64) unicode_category(r) | ((u64) unicode_east_asian_width(r) << 8), unicode_to_upper(r), unicode_to_lower(r) };
+        for (usize k = 0; k < 3; ++k)
+            digest = (digest ^ values[k]) * 0x100000001B3ULL;
+    }
+    ASSERTF(digest == UNICODE_DIGEST, "Digest 0x%016llX.", (unsigned long long) digest);
+}
+
+static void test_known_runes(void)
+{
+    for (usize i = 0; i < ARRAY_COUNT(KNOWN_RUNES); ++i)
+    {
+        KnownRune known = KNOWN_RUNES[i];
+        ASSERTF(unicode_category(known.r) == known.category, "U+%04X", (unsigned) known.r);
+        ASSERTF(unicode_east_asian_width(known.r) == known.width, "U+%04X", (unsigned) known.r);
+        ASSERTF(unicode_to_upper(known.r) == known.upper, "U+%04X", (unsigned) known.r);
+        ASSERTF(unicode_to_lower(known.r) == known.lower, "U+%04X", (unsigned) known.r);
+    }
+}
+
+static void test_ascii_and_helpers(void)
+{
+    /* The ASCII fast paths agree with the C locale. */
+    for (rune r = 0; r < 128; ++r)
+    {
+        ASSERT(unicode_is_letter(r) == (isalpha((int) r) != 0));
+        ASSERT(unicode_is_number(r) == (isdigit((int) r) != 0));
+        ASSERT(unicode_to_upper(r) == (rune) toupper((int) r));
+        ASSERT(unicode_to_lower(r) == (rune) tolower((int) r));
+        ASSERT(unicode_is_whitespace(r) == (isspace((int) r) != 0));
+        ASSERT(unicode_column_width(r) == (u32) (isprint((int) r) != 0));
+    }
+
+    ASSERT(unicode_category(0x110000) == UNICODE_CATEGORY_CN && unicode_to_upper(0xFFFFFFFF) == 0xFFFFFFFF);
+    ASSERT(unicode_is_whitespace(0x3000) && unicode_is_whitespace(0x85) && !unicode_is_whitespace(0x200B));
+    ASSERT(unicode_is_mark(0x301) && unicode_is_punctuation(0x3001) && unicode_is_number(0x2160));
+    ASSERT(unicode_column_width(0x4E00) == 2 && unicode_column_width(0x301) == 0 && unicode_column_width(0x200B) == 0);
+    ASSERT(unicode_column_width(0x1F600) == 2 && unicode_column_width(0xE9) == 1);
+
+    /* Case mappings stay inside Unicode and keep the letter a letter. */
+    for (rune r = 0; r <= UNICODE_MAX_RUNE; ++r)
+    {
+        rune upper = unicode_to_upper(r);
+        rune lower = unicode_to_lower(r);
+        ASSERT(upper <= UNICODE_MAX_RUNE && lower <= UNICODE_MAX_RUNE);
+        ASSERT(upper == r || unicode_is_letter(upper) || unicode_category(upper) == UNICODE_CATEGORY_NL || unicode_category(upper) == UNICODE_CATEGORY_SO);
+    }
+}
+
+int main(void)
+{
+    test_digest();
+    test_known_runes();
+    test_ascii_and_helpers();
+    return 0;
+}
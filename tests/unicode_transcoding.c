@@ -0,0 +1,136 @@
+/* Tests for the UNICODE TRANSCODING section: round trips through every
+    encoding on random text (ASCII, mixed, and only 2, 3 or 4-byte runes, which
+    take different SIMD steps), and error positions on corrupted input. */
+#include "test.h"
+
+static rune random_rune(usize mode)
+{
+    usize kind = mode >= 3 ? mode + 4 : test_random_below(10);
+    if (mode == 0 || kind < 6)
+        return (rune) test_random_below(0x80);
+    if (kind < 8)
+        return (rune) (0x80 + test_random_below(0x780));
+    if (kind < 9)
+    {
+        rune r = (rune) (0x800 + test_random_below(0xF800));
+        return (r >= 0xD800 && r <= 0xDFFF) ? 0xE000 : r;
+    }
+    return (rune) (0x10000 + test_random_below(0x100000));
+}
+
+/* Checks `units` against `runes` encoded as UTF-16. */
+static void check_utf16(const rune* runes, usize count, const u16* units, usize written)
+{
+    usize at = 0;
+    for (usize i = 0; i < count; ++i)
+    {
+        rune r = runes[i];
+        if (r < 0x10000)
+        {
+            ASSERT(at < written && units[at++] == r);
+            continue;
+        }
+        r -= 0x10000;
+        ASSERT(at + 1 < written && units[at] == (0xD800 | (r >> 10)) && units[at + 1] == (0xDC00 | (r & 0x3FF)));
+        at += 2;
+    }
+    ASSERT(at == written);
+}
+
+static void test_round_trips_and_errors(void)
+{
+    static rune runes[300];
+    static rune decoded[1200];
+    static u16  units[1200];
+    static u8   text[1200];
+    static u8   again[1200];
+    for (usize round = 0; round < 200000; ++round)
+    {
+        usize mode  = test_random_below(6);
+        usize count = test_random_below(300);
+        usize size  = 0;
+        for (usize i = 0; i < count; ++i)
+        {
+            runes[i] = random_rune(mode);
+            size += utf8_encode(runes[i], (utf8*) text + size);
+        }
+
+        TranscodeResult to_32 = utf8_to_utf32((const utf8*) text, size, decoded);
+        ASSERT(to_32.valid && to_32.read == size && to_32.written == count);
+        ASSERT(memcmp(decoded, runes, count * sizeof(rune)) == 0);
+
+        TranscodeResult from_32 = utf32_to_utf8(runes, count, (utf8*) again);
+        ASSERT(from_32.valid && from_32.written == size && memcmp(again, text, size) == 0);
+
+        TranscodeResult to_16 = utf8_to_utf16((const utf8*) text, size, units);
+        ASSERT(to_16.valid && to_16.read == size);
+        check_utf16(runes, count, units, to_16.written);
+
+        TranscodeResult from_16 = utf16_to_utf8(units, to_16.written, (utf8*) again);
+        ASSERT(from_16.valid && from_16.written == size && memcmp(again, text, size) == 0);
+
+        /* One corrupted byte: the error is where utf8_decode first fails. */
+        if (size)
+        {
+            text[test_random_below(size)] = (u8) test_random();
+            usize read    = 0;
+            usize written = 0;
+            rune  r;
+            while (read < size)
+            {
+                usize length = utf8_decode((const utf8*) text + read, size - read, &r);
+                if (!length)
+                    break;
+                read += length;
+                written += 1;
+            }
+            bool valid = read == size;
+            TranscodeResult bad_32 = utf8_to_utf32((const utf8*) text, size, decoded);
+            ASSERT(bad_32.valid == valid && bad_32.read == read && bad_32.written == written);
+            TranscodeResult bad_16 = utf8_to_utf16((const utf8*) text, size, units);
+            ASSERT(bad_16.valid == valid && bad_16.read == read);
+            ASSERT(utf8_is_valid((const utf8*) text, size) == valid);
+        }
+
+        /* Surrogates are invalid as runes, and unpaired as UTF-16. */
+        if (count)
+        {
+            usize at = test_random_below(count);
+            runes[at] = (rune) (0xD800 + test_random_below(0x800));
+            TranscodeResult bad = utf32_to_utf8(runes, count, (utf8*) again);
+            ASSERT(!bad.valid && bad.read == at);
+        }
+        if (to_16.written)
+        {
+            usize at = test_random_below(to_16.written);
+            units[at] = 0xDC00;
+            TranscodeResult bad = utf16_to_utf8(units, to_16.written, (utf8*) again);
+            ASSERT(!bad.valid || (at > 0 && units[at - 1] >= 0xD800 && units[at - 1] < 0xDC00));
+        }
+    }
+}
+
+static void test_single_runes(void)
+{
+    utf8 bytes[4];
+    for (rune r = 0; r <= UNICODE_MAX_RUNE + 1; ++r)
+    {
+        usize length = utf8_encode(r, bytes);
+        if ((r >= 0xD800 && r <= 0xDFFF) || r > UNICODE_MAX_RUNE)
+        {
+            ASSERT(length == 0);
+            continue;
+        }
+        rune back = 0;
+        ASSERT(length == (usize) (r < 0x80 ? 1 : r < 0x800 ? 2 : r < 0x10000 ? 3 : 4));
+        ASSERT(utf8_decode(bytes, length, &back) == length && back == r);
+        ASSERT(utf8_decode(bytes, length - 1, &back) == 0);
+    }
+}
+
+int main(void)
+{
+    test_single_runes();
+    test_round_trips_and_errors();
+    return 0;
+}
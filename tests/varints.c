@@ -0,0 +1,123 @@
+/* Tests for the VARINTS section: LEB128 round trips for values of every
+    length with and without readable bytes past the end, truncated, overlong
+    and overflowing inputs, and Stream-VByte against an encoder written out
+    byte by byte from the format. */
+#include "test.h"
+
+#define MAX_VALUES 5000
+
+static u64 random_magnitude(void)
+{
+    return test_random() >> (test_random() & 63);
+}
+
+static void test_leb128(void)
+{
+    u8  encoded[32];
+    u8  padded[32];
+    u64 value;
+    u32 value_32;
+    i64 signed_value;
+
+    ASSERT(varint_encode_u64(encoded, 300) == 2 && encoded[0] == 0xAC && encoded[1] == 0x02);
+    ASSERT(varint_encode_i64(encoded, -300) == 2 && encoded[0] == 0xD7 && encoded[1] == 0x04);
+    ASSERT(varint_decode_i64(encoded, 2, &signed_value) == 2 && signed_value == -300);
+    ASSERT(varint_encode_u64(encoded, 0) == 1 && encoded[0] == 0);
+    ASSERT(varint_encode_u64(encoded, ~0ULL) == VARINT_MAX_SIZE_U64);
+
+    for (usize iteration = 0; iteration < 2000000; ++iteration)
+    {
+        /* Random bytes after the varint, which mustn't be read. */
+        u64   x       = random_magnitude();
+        usize padding = test_random_below(12);
+        usize size    = varint_encode_u64(encoded, x);
+        ASSERT(size >= 1 && size <= VARINT_MAX_SIZE_U64 && size == (x ? (bit_log2_u64(x) + 7) / 7 : 1));
+        memcpy(padded, encoded, size);
+        for (usize k = size; k < sizeof(padded); ++k)
+            padded[k] = (u8) test_random();
+
+        ASSERT(varint_decode_u64(padded, size + padding, &value) == size && value == x);
+        ASSERT(size == 1 || varint_decode_u64(padded, size - 1, &value) == 0);
+        usize read = varint_decode_u32(padded, size + padding, &value_32);
+        ASSERT(x >> 32 ? read == 0 : read == size && value_32 == x);
+        ASSERT(x >> 32 || varint_encode_u32(encoded, (u32) x) == size);
+
+        i64 sx = (i64) x * ((iteration & 1) ? -1 : 1);
+        size = varint_encode_i64(padded, sx);
+        ASSERT(varint_decode_i64(padded, size + padding, &signed_value) == size && signed_value == sx);
+        ASSERT(varint_zigzag_decode(varint_zigzag_encode(sx)) == sx);
+    }
+    ASSERT(varint_zigzag_encode(0) == 0 && varint_zigzag_encode(-1) == 1 && varint_zigzag_encode(1) == 2);
+    ASSERT(varint_zigzag_encode(INT64_MAX) == ~0ULL - 1 && varint_zigzag_encode(INT64_MIN) == ~0ULL);
+
+    /* The tenth byte of a u64 holds one bit, the fifth of a u32 four. */
+    u8 longest[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+    ASSERT(varint_decode_u64(longest, 16, &value) == 10 && value == ~0ULL);
+    ASSERT(varint_decode_u64(longest, 10, &value) == 10 && value == ~0ULL);
+    longest[9] = 0x02;
+    ASSERT(varint_decode_u64(longest, 16, &value) == 0 && varint_decode_u64(longest, 10, &value) == 0);
+    longest[9] = 0x81;
+    ASSERT(varint_decode_u64(longest, 16, &value) == 0);
+
+    u8 longest_32[8] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F };
+    ASSERT(varint_decode_u32(longest_32, 8, &value_32) == 5 && value_32 == ~0u);
+    ASSERT(varint_decode_u32(longest_32, 5, &value_32) == 5 && value_32 == ~0u);
+    longest_32[4] = 0x1F;
+    ASSERT(varint_decode_u32(longest_32, 8, &value_32) == 0 && varint_decode_u32(longest_32, 5, &value_32) == 0);
+
+    u8 overlong[8] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 };
+    ASSERT(varint_decode_u32(overlong, 8, &value_32) == 0 && varint_decode_u32(overlong, 6, &value_32) == 0);
+    ASSERT(varint_decode_u64(overlong, 0, &value) == 0);
+}
+
+/* Control bytes first, two bits per value (bytes - 1), the first value in
+    the lowest bits; then each value's bytes, least significant first. */
+static usize naive_stream_vbyte(const u32* values, usize count, u8* out)
+{
+    usize controls = (count + 3) / 4;
+    usize written  = controls;
+    memset(out, 0, controls);
+    for (usize i = 0; i < count; ++i)
+    {
+        u32 bytes = values[i] >> 24 ? 4 : values[i] >> 16 ? 3 : values[i] >> 8 ? 2 : 1;
+        out[i / 4] |= (u8) ((bytes - 1) << ((i & 3) * 2));
+        for (u32 b = 0; b < bytes; ++b)
+            out[written++] = (u8) (values[i] >> (b * 8));
+    }
+    return written;
+}
+
+static void test_stream_vbyte(void)
+{
+    static u32 values[MAX_VALUES];
+    static u32 decoded[MAX_VALUES];
+    static u8  expected[MAX_VALUES * 5];
+    for (usize iteration = 0; iteration < 3000; ++iteration)
+    {
+        usize count = test_random_below(MAX_VALUES);
+        for (usize i = 0; i < count; ++i)
+            values[i] = (u32) (test_random() >> (32 + (test_random() & 31)));
+
+        usize capacity = stream_vbyte_max_size(count);
+        u8*   encoded  = (u8*) malloc(capacity ? capacity : 1);
+        usize size     = stream_vbyte_encode(values, count, encoded);
+        ASSERT(size <= capacity);
+        ASSERT(size == naive_stream_vbyte(values, count, expected) && memcmp(encoded, expected, size) == 0);
+
+        /* Decoding reads exactly `size` bytes, so a tight allocation is fine. */
+        u8* exact = (u8*) malloc(size ? size : 1);
+        memcpy(exact, encoded, size);
+        ASSERT(stream_vbyte_decode(exact, size, decoded, count) == size);
+        ASSERT(memcmp(decoded, values, count * sizeof(u32)) == 0);
+        ASSERT(size == (count + 3) / 4 || stream_vbyte_decode(exact, size - 1, decoded, count) == 0);
+        free(exact);
+        free(encoded);
+    }
+}
+
+int main(void)
+{
+    test_leb128();
+    test_stream_vbyte();
+    return 0;
+}